@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/corpus.h>
+#include <libversion/sort.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/file.h>
+#include <libversion/private/key.h>
+#include <libversion/private/parallel.h>
+
+#define CORPUS_FLAGS_MASK (VERSIONCORPUS_NUL_DELIMITED)
+#define MIN_CHUNK_SIZE 65536
+#define QUERY_KEY_LENGTH 512
+
+/* records double as sort items, so the corpus is sorted in place */
+typedef version_sort_item_t record_t;
+
+typedef struct {
+	const char* begin;
+	const char* end;
+
+	record_t* records;
+	size_t num_records;
+	size_t records_capacity;
+
+	unsigned char* keys;
+	size_t keys_length;
+	size_t keys_capacity;
+
+	int failed;
+} chunk_t;
+
+typedef struct {
+	chunk_t* chunks;
+	char delimiter;
+	int flags;
+} loader_t;
+
+struct version_corpus {
+	file_data_t file;
+
+	record_t* records;
+	size_t num_records;
+
+	unsigned char** key_arenas;
+	size_t num_key_arenas;
+};
+
+static int reserve_records(chunk_t* chunk) {
+	size_t capacity = chunk->records_capacity ? chunk->records_capacity * 2 : 1024;
+	record_t* records;
+
+	if (chunk->num_records < chunk->records_capacity)
+		return 1;
+
+	records = realloc(chunk->records, capacity * sizeof(record_t));
+	if (records == NULL)
+		return 0;
+
+	chunk->records = records;
+	chunk->records_capacity = capacity;
+	return 1;
+}
+
+static int reserve_keys(chunk_t* chunk, size_t length) {
+	size_t capacity = chunk->keys_capacity ? chunk->keys_capacity : 4096;
+	unsigned char* keys;
+
+	if (chunk->keys_length + length <= chunk->keys_capacity)
+		return 1;
+
+	while (chunk->keys_length + length > capacity)
+		capacity *= 2;
+
+	keys = realloc(chunk->keys, capacity);
+	if (keys == NULL)
+		return 0;
+
+	chunk->keys = keys;
+	chunk->keys_capacity = capacity;
+	return 1;
+}
+
+static size_t build_key(const char* version, size_t length, int flags, unsigned char* key, size_t capacity) {
+	version_stream_t stream;
+
+	version_stream_init(&stream, flags, key, capacity);
+	version_stream_feed(&stream, version, length);
+	return version_stream_finish(&stream);
+}
+
+static void load_chunk(size_t index, void* context) {
+	const loader_t* loader = (const loader_t*)context;
+	chunk_t chunk = loader->chunks[index]; /* work on a local copy to avoid false sharing between workers */
+	const char* cur = chunk.begin;
+	const char* next;
+	size_t i, length, key_length, key_offset;
+	record_t* record;
+
+	while (cur < chunk.end) {
+		next = memchr(cur, loader->delimiter, chunk.end - cur);
+		if (next == NULL)
+			next = chunk.end;
+
+		length = next - cur;
+		if (loader->delimiter == '\n' && length > 0 && cur[length - 1] == '\r')
+			length--;
+
+		if (!reserve_records(&chunk) || !reserve_keys(&chunk, VERSION_KEY_MAX_LENGTH(length))) {
+			chunk.failed = 1;
+			break;
+		}
+
+		key_length = build_key(cur, length, loader->flags, chunk.keys + chunk.keys_length, chunk.keys_capacity - chunk.keys_length);
+		if (key_length == 0) {
+			chunk.failed = 1;
+			break;
+		}
+
+		record = &chunk.records[chunk.num_records++];
+		record->text = cur;
+		record->text_length = length;
+		record->key_length = key_length;
+		chunk.keys_length += key_length;
+
+		cur = next + 1;
+	}
+
+	/* key storage may have moved while loading, so keys are only pointed to now */
+	for (i = 0, key_offset = 0; i < chunk.num_records; i++) {
+		chunk.records[i].key = chunk.keys + key_offset;
+		key_offset += chunk.records[i].key_length;
+	}
+
+	loader->chunks[index] = chunk;
+}
+
+static const char* find_record_start(const char* begin, const char* pos, const char* end, char delimiter) {
+	const char* found;
+
+	if (pos == begin)
+		return pos;
+
+	/* record which spans nominal chunk boundary belongs to the previous chunk */
+	found = memchr(pos - 1, delimiter, end - (pos - 1));
+	return found ? found + 1 : end;
+}
+
+version_corpus_t* version_corpus_load_file(const char* path, int flags, int threads) {
+	version_corpus_t* corpus;
+	loader_t loader;
+	size_t num_chunks, i, num_records;
+	const char* begin;
+	const char* end;
+	int failed = 0;
+
+	corpus = calloc(1, sizeof(version_corpus_t));
+	if (corpus == NULL)
+		return NULL;
+
+	if (!file_data_load(&corpus->file, path)) {
+		int saved_errno = errno;
+		version_corpus_free(corpus);
+		errno = saved_errno;
+		return NULL;
+	}
+
+	if (corpus->file.length == 0)
+		return corpus;
+
+	/* don't bother spawning threads for tiny chunks */
+	num_chunks = parallel_resolve_threads(threads);
+	if (num_chunks > corpus->file.length / MIN_CHUNK_SIZE)
+		num_chunks = corpus->file.length / MIN_CHUNK_SIZE;
+	if (num_chunks == 0)
+		num_chunks = 1;
+
+	loader.chunks = calloc(num_chunks, sizeof(chunk_t));
+	loader.delimiter = (flags & VERSIONCORPUS_NUL_DELIMITED) ? '\0' : '\n';
+	loader.flags = flags & ~CORPUS_FLAGS_MASK;
+	if (loader.chunks == NULL) {
+		version_corpus_free(corpus);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	begin = corpus->file.data;
+	end = corpus->file.data + corpus->file.length;
+	for (i = 0; i < num_chunks; i++) {
+		loader.chunks[i].begin = find_record_start(begin, begin + corpus->file.length / num_chunks * i, end, loader.delimiter);
+		if (i > 0)
+			loader.chunks[i - 1].end = loader.chunks[i].begin;
+	}
+	loader.chunks[num_chunks - 1].end = end;
+
+	parallel_run(num_chunks, num_chunks, load_chunk, &loader);
+
+	/* merge chunk results */
+	num_records = 0;
+	for (i = 0; i < num_chunks; i++) {
+		failed |= loader.chunks[i].failed;
+		num_records += loader.chunks[i].num_records;
+	}
+
+	corpus->key_arenas = calloc(num_chunks, sizeof(unsigned char*));
+	corpus->records = malloc((num_records ? num_records : 1) * sizeof(record_t));
+	if (corpus->key_arenas == NULL || corpus->records == NULL)
+		failed = 1;
+
+	for (i = 0; i < num_chunks; i++) {
+		if (!failed) {
+			if (loader.chunks[i].num_records)
+				memcpy(corpus->records + corpus->num_records, loader.chunks[i].records, loader.chunks[i].num_records * sizeof(record_t));
+			corpus->num_records += loader.chunks[i].num_records;
+			corpus->key_arenas[corpus->num_key_arenas++] = loader.chunks[i].keys;
+		} else {
+			free(loader.chunks[i].keys);
+		}
+		free(loader.chunks[i].records);
+	}
+	free(loader.chunks);
+
+	if (failed) {
+		version_corpus_free(corpus);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	return corpus;
+}
+
+void version_corpus_free(version_corpus_t* corpus) {
+	size_t i;
+
+	if (corpus == NULL)
+		return;
+
+	for (i = 0; i < corpus->num_key_arenas; i++)
+		free(corpus->key_arenas[i]);
+	free(corpus->key_arenas);
+	free(corpus->records);
+
+	file_data_release(&corpus->file);
+
+	free(corpus);
+}
+
+size_t version_corpus_size(const version_corpus_t* corpus) {
+	return corpus->num_records;
+}
+
+const char* version_corpus_version(const version_corpus_t* corpus, size_t index, size_t* length) {
+	if (length != NULL)
+		*length = corpus->records[index].text_length;
+	return corpus->records[index].text;
+}
+
+const unsigned char* version_corpus_key(const version_corpus_t* corpus, size_t index, size_t* length) {
+	if (length != NULL)
+		*length = corpus->records[index].key_length;
+	return corpus->records[index].key;
+}
+
+void version_corpus_sort(version_corpus_t* corpus) {
+	version_sort_items(corpus->records, corpus->num_records, VERSIONSORT_AUTO);
+}
+
+static size_t bound(const version_corpus_t* corpus, const char* v, int flags, int upper) {
+	unsigned char stack_key[QUERY_KEY_LENGTH];
+	unsigned char* key = stack_key;
+	size_t key_length, low = 0, high = corpus->num_records, mid;
+	int res;
+
+	key_length = version_key(v, flags, key, sizeof(stack_key));
+	if (key_length > sizeof(stack_key)) {
+		key = malloc(key_length);
+		if (key == NULL)
+			return VERSIONCORPUS_ERROR;
+		version_key(v, flags, key, key_length);
+	}
+
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		res = key_compare(corpus->records[mid].key, corpus->records[mid].key_length, key, key_length);
+		if (res < 0 || (upper && res == 0))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (key != stack_key)
+		free(key);
+
+	return low;
+}
+
+size_t version_corpus_lower_bound(const version_corpus_t* corpus, const char* v, int flags) {
+	return bound(corpus, v, flags, 0);
+}
+
+size_t version_corpus_upper_bound(const version_corpus_t* corpus, const char* v, int flags) {
+	return bound(corpus, v, flags, 1);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_CORPUS_H
+#define LIBVERSION_CORPUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include <libversion/version.h>
+
+enum {
+	/* records are delimited by NUL bytes instead of newlines */
+	VERSIONCORPUS_NUL_DELIMITED = 0x100,
+};
+
+/* returned by bound functions if memory allocation for a long query key has failed */
+#define VERSIONCORPUS_ERROR ((size_t)-1)
+
+typedef struct version_corpus version_corpus_t;
+
+extern LIBVERSION_EXPORT version_corpus_t* version_corpus_load_file(const char* path, int flags, int threads);
+extern LIBVERSION_EXPORT void version_corpus_free(version_corpus_t* corpus);
+
+extern LIBVERSION_EXPORT size_t version_corpus_size(const version_corpus_t* corpus);
+extern LIBVERSION_EXPORT const char* version_corpus_version(const version_corpus_t* corpus, size_t index, size_t* length);
+extern LIBVERSION_EXPORT const unsigned char* version_corpus_key(const version_corpus_t* corpus, size_t index, size_t* length);
+
+extern LIBVERSION_EXPORT void version_corpus_sort(version_corpus_t* corpus);
+extern LIBVERSION_EXPORT size_t version_corpus_lower_bound(const version_corpus_t* corpus, const char* v, int flags);
+extern LIBVERSION_EXPORT size_t version_corpus_upper_bound(const version_corpus_t* corpus, const char* v, int flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBVERSION_CORPUS_H */
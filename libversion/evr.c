@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/evr.h>
+
+#include <string.h>
+
+#include <libversion/private/compare.h>
+#include <libversion/private/component.h>
+#include <libversion/private/key.h>
+#include <libversion/private/string.h>
+
+#define EVR_FLAGS_MASK (VERSIONFLAG_P_IS_PATCH | VERSIONFLAG_ANY_IS_PATCH)
+
+/*
+ * Segments of epoch:version-release string, located in place. Epoch
+ * is a run of digits terminated by colon at the start of the string
+ * (missing epoch is zero), release follows the last hyphen (missing
+ * release is empty). As both colon and hyphen are separators, version
+ * components never span segment boundaries, so each segment is parsed
+ * by iterating the whole string from the segment start until the
+ * first component past the segment end.
+ */
+typedef struct {
+	const char* epoch;
+	size_t epoch_length;        /* without leading zeroes */
+	const char* version;
+	size_t version_length;
+	const char* release;
+	size_t release_length;
+} evr_t;
+
+typedef struct {
+	version_iter_t iter;
+	size_t length;
+	int exhausted;
+} segment_iter_t;
+
+static void split_evr(const char* v, evr_t* evr) {
+	const char* cur = v;
+	const char* hyphen;
+
+	while (my_isnumber(*cur))
+		cur++;
+
+	if (*cur == ':') {
+		evr->epoch = v;
+		evr->epoch_length = cur - v;
+		v = cur + 1;
+	} else {
+		evr->epoch = v;
+		evr->epoch_length = 0;
+	}
+
+	while (evr->epoch_length > 0 && *evr->epoch == '0') {
+		evr->epoch++;
+		evr->epoch_length--;
+	}
+
+	hyphen = strrchr(v, '-');
+
+	evr->version = v;
+	if (hyphen != NULL) {
+		evr->version_length = hyphen - v;
+		evr->release = hyphen + 1;
+		evr->release_length = strlen(hyphen + 1);
+	} else {
+		evr->version_length = strlen(v);
+		evr->release = v + evr->version_length;
+		evr->release_length = 0;
+	}
+}
+
+static void segment_iter_init(segment_iter_t* iter, const char* segment, size_t length, int flags) {
+	version_iter_init(&iter->iter, segment, flags);
+	iter->length = length;
+	iter->exhausted = 0;
+}
+
+static int segment_iter_next(segment_iter_t* iter, version_component_t* component) {
+	if (!iter->exhausted && (!version_iter_next(&iter->iter, component) || component->offset >= iter->length))
+		iter->exhausted = 1;
+	return !iter->exhausted;
+}
+
+/* shorter segment is padded with zeroes, as in version_compare4 */
+static void get_component(const char* segment, const version_component_t* in, int has_component, component_t* out) {
+	static const char* empty = "";
+
+	if (has_component) {
+		out->metaorder = in->metaorder;
+		out->start = segment + in->offset;
+		out->end = out->start + in->length;
+	} else {
+		out->metaorder = METAORDER_ZERO;
+		out->start = empty;
+		out->end = empty;
+	}
+}
+
+static int compare_segments(const char* s1, size_t l1, const char* s2, size_t l2, int s1_flags, int s2_flags) {
+	segment_iter_t it1, it2;
+	version_component_t vc1, vc2;
+	component_t c1, c2;
+	int has1, has2, res;
+
+	segment_iter_init(&it1, s1, l1, s1_flags);
+	segment_iter_init(&it2, s2, l2, s2_flags);
+
+	for (;;) {
+		has1 = segment_iter_next(&it1, &vc1);
+		has2 = segment_iter_next(&it2, &vc2);
+		if (!has1 && !has2)
+			return 0;
+
+		get_component(s1, &vc1, has1, &c1);
+		get_component(s2, &vc2, has2, &c2);
+
+		if ((res = compare_components(&c1, &c2)) != 0)
+			return res;
+	}
+}
+
+static void encode_segment(key_encoder_t* encoder, const char* segment, size_t length, int flags) {
+	segment_iter_t iter;
+	version_component_t component;
+
+	segment_iter_init(&iter, segment, length, flags);
+	while (segment_iter_next(&iter, &component))
+		key_encoder_push(encoder, component.metaorder, segment + component.offset, component.length);
+}
+
+int version_evr_compare(const char* v1, const char* v2, int v1_flags, int v2_flags) {
+	evr_t e1, e2;
+	int res;
+
+	split_evr(v1, &e1);
+	split_evr(v2, &e2);
+
+	/* epochs are compared numerically */
+	if (e1.epoch_length != e2.epoch_length)
+		return e1.epoch_length < e2.epoch_length ? -1 : 1;
+	if ((res = memcmp(e1.epoch, e2.epoch, e1.epoch_length)) != 0)
+		return res < 0 ? -1 : 1;
+
+	if ((res = compare_segments(e1.version, e1.version_length, e2.version, e2.version_length, v1_flags & EVR_FLAGS_MASK, v2_flags & EVR_FLAGS_MASK)) != 0)
+		return res;
+
+	return compare_segments(e1.release, e1.release_length, e2.release, e2.release_length, v1_flags & EVR_FLAGS_MASK, v2_flags & EVR_FLAGS_MASK);
+}
+
+/* keys are prefix free, so concatenation of segment keys orders the same way as segments */
+size_t version_evr_key(const char* v, int flags, unsigned char* key, size_t capacity) {
+	key_encoder_t encoder;
+	evr_t evr;
+
+	split_evr(v, &evr);
+	flags &= EVR_FLAGS_MASK;
+
+	key_encoder_init(&encoder, flags, key, capacity);
+	key_encoder_push_number(&encoder, evr.epoch, evr.epoch_length);
+
+	encode_segment(&encoder, evr.version, evr.version_length, flags);
+	key_encoder_finish(&encoder);
+
+	encode_segment(&encoder, evr.release, evr.release_length, flags);
+	return key_encoder_finish(&encoder);
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/filter.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/file.h>
+
+#define FILTER_MAGIC "LVBLOOM1"
+#define FILTER_MAGIC_LENGTH 8
+#define FILTER_HEADER_LENGTH 24
+#define BLOCK_BYTES 64
+#define BLOCK_BITS (BLOCK_BYTES * 8)
+#define MAX_HASHES 16
+
+/*
+ * Blocked Bloom filter: every version sets bits in a single 64 byte
+ * block, so a lookup costs at most one cache miss. In memory, the
+ * filter is kept in its serialized form (header followed by blocks),
+ * so a serialized filter may be used in place, e.g. from a mapped
+ * file.
+ *
+ * Header layout (integers are big endian):
+ *   8 bytes  magic
+ *   8 bytes  number of blocks
+ *   4 bytes  number of hash functions
+ *   4 bytes  reserved, zero
+ */
+struct version_filter {
+	unsigned char* data;        /* NULL for read only filters */
+	const unsigned char* blocks;
+	size_t length;
+	size_t num_blocks;
+	unsigned num_hashes;
+	file_data_t file;
+};
+
+static uint64_t read_be(const unsigned char* data, size_t length) {
+	uint64_t value = 0;
+
+	while (length-- > 0)
+		value = (value << 8) | *data++;
+
+	return value;
+}
+
+static void write_be(unsigned char* data, uint64_t value, size_t length) {
+	while (length-- > 0) {
+		data[length] = (unsigned char)value;
+		value >>= 8;
+	}
+}
+
+static version_filter_t* attach(version_filter_t* filter, const unsigned char* data, size_t length) {
+	uint64_t num_blocks;
+	uint64_t num_hashes;
+
+	if (length < FILTER_HEADER_LENGTH || memcmp(data, FILTER_MAGIC, FILTER_MAGIC_LENGTH) != 0)
+		return NULL;
+
+	num_blocks = read_be(data + 8, 8);
+	num_hashes = read_be(data + 16, 4);
+
+	if (num_blocks == 0 || num_blocks != (length - FILTER_HEADER_LENGTH) / BLOCK_BYTES || (length - FILTER_HEADER_LENGTH) % BLOCK_BYTES != 0)
+		return NULL;
+	if (num_hashes == 0 || num_hashes > MAX_HASHES)
+		return NULL;
+
+	filter->blocks = data + FILTER_HEADER_LENGTH;
+	filter->length = length;
+	filter->num_blocks = (size_t)num_blocks;
+	filter->num_hashes = (unsigned)num_hashes;
+	return filter;
+}
+
+version_filter_t* version_filter_create(size_t count, unsigned bits_per_version) {
+	version_filter_t* filter;
+	size_t num_blocks = (count * bits_per_version + BLOCK_BITS - 1) / BLOCK_BITS;
+	unsigned num_hashes = (bits_per_version * 69 + 50) / 100;  /* bits * ln(2) is optimal */
+
+	if (num_blocks == 0)
+		num_blocks = 1;
+	if (num_hashes == 0)
+		num_hashes = 1;
+	if (num_hashes > MAX_HASHES)
+		num_hashes = MAX_HASHES;
+
+	if ((filter = calloc(1, sizeof(version_filter_t))) == NULL)
+		return NULL;
+
+	filter->data = calloc(FILTER_HEADER_LENGTH + num_blocks * BLOCK_BYTES, 1);
+	if (filter->data == NULL) {
+		free(filter);
+		return NULL;
+	}
+
+	memcpy(filter->data, FILTER_MAGIC, FILTER_MAGIC_LENGTH);
+	write_be(filter->data + 8, num_blocks, 8);
+	write_be(filter->data + 16, num_hashes, 4);
+
+	return attach(filter, filter->data, FILTER_HEADER_LENGTH + num_blocks * BLOCK_BYTES);
+}
+
+version_filter_t* version_filter_view(const void* data, size_t length) {
+	version_filter_t* filter;
+
+	if ((filter = calloc(1, sizeof(version_filter_t))) == NULL)
+		return NULL;
+
+	if (attach(filter, (const unsigned char*)data, length) == NULL) {
+		free(filter);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return filter;
+}
+
+version_filter_t* version_filter_open_file(const char* path) {
+	version_filter_t* filter;
+
+	if ((filter = calloc(1, sizeof(version_filter_t))) == NULL)
+		return NULL;
+
+	if (!file_data_load(&filter->file, path)) {
+		int saved_errno = errno;
+		free(filter);
+		errno = saved_errno;
+		return NULL;
+	}
+
+	if (attach(filter, (const unsigned char*)filter->file.data, filter->file.length) == NULL) {
+		version_filter_free(filter);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return filter;
+}
+
+void version_filter_free(version_filter_t* filter) {
+	if (filter == NULL)
+		return;
+
+	file_data_release(&filter->file);
+	free(filter->data);
+	free(filter);
+}
+
+/* block is chosen by the high half of the hash, bits within it by double hashing of the low half */
+static void get_bits(const version_filter_t* filter, uint64_t hash, size_t* bits) {
+	size_t block = (size_t)((hash >> 32) % filter->num_blocks) * BLOCK_BITS;
+	unsigned h1 = (unsigned)(hash & 0xffff), h2 = (unsigned)((hash >> 16) & 0xffff) | 1;
+	unsigned i;
+
+	for (i = 0; i < filter->num_hashes; i++)
+		bits[i] = block + (h1 + i * h2) % BLOCK_BITS;
+}
+
+int version_filter_add_hash(version_filter_t* filter, uint64_t hash) {
+	size_t bits[MAX_HASHES];
+	unsigned i;
+
+	if (filter->data == NULL)
+		return 0;
+
+	get_bits(filter, hash, bits);
+	for (i = 0; i < filter->num_hashes; i++)
+		filter->data[FILTER_HEADER_LENGTH + bits[i] / 8] |= 1 << (bits[i] % 8);
+
+	return 1;
+}
+
+int version_filter_contains_hash(const version_filter_t* filter, uint64_t hash) {
+	size_t bits[MAX_HASHES];
+	unsigned i;
+	int found = 1;
+
+	get_bits(filter, hash, bits);
+	for (i = 0; i < filter->num_hashes; i++)
+		found &= (filter->blocks[bits[i] / 8] >> (bits[i] % 8)) & 1;
+
+	return found;
+}
+
+int version_filter_add(version_filter_t* filter, const char* v, int flags) {
+	return version_filter_add_hash(filter, version_hash(v, flags));
+}
+
+int version_filter_contains(const version_filter_t* filter, const char* v, int flags) {
+	return version_filter_contains_hash(filter, version_hash(v, flags));
+}
+
+size_t version_filter_serialize(const version_filter_t* filter, unsigned char* out, size_t capacity) {
+	const unsigned char* data = filter->blocks - FILTER_HEADER_LENGTH;
+
+	if (capacity > 0)
+		memcpy(out, data, capacity < filter->length ? capacity : filter->length);
+
+	return filter->length;
+}
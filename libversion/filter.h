@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_FILTER_H
+#define LIBVERSION_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <libversion/version.h>
+
+typedef struct version_filter version_filter_t;
+
+extern LIBVERSION_EXPORT version_filter_t* version_filter_create(size_t count, unsigned bits_per_version);
+extern LIBVERSION_EXPORT version_filter_t* version_filter_view(const void* data, size_t length);
+extern LIBVERSION_EXPORT version_filter_t* version_filter_open_file(const char* path);
+extern LIBVERSION_EXPORT void version_filter_free(version_filter_t* filter);
+
+extern LIBVERSION_EXPORT int version_filter_add(version_filter_t* filter, const char* v, int flags);
+extern LIBVERSION_EXPORT int version_filter_add_hash(version_filter_t* filter, uint64_t hash);
+extern LIBVERSION_EXPORT int version_filter_contains(const version_filter_t* filter, const char* v, int flags);
+extern LIBVERSION_EXPORT int version_filter_contains_hash(const version_filter_t* filter, uint64_t hash);
+
+extern LIBVERSION_EXPORT size_t version_filter_serialize(const version_filter_t* filter, unsigned char* out, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBVERSION_FILTER_H */
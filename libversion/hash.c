@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/version.h>
+
+#include <libversion/private/string.h>
+
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+/* markers distinguishing how the version ends, never equal to a metaorder */
+enum {
+	HASH_END_LOWER_BOUND = 0x10,
+	HASH_END = 0x11,
+	HASH_END_UPPER_BOUND = 0x12,
+};
+
+static inline uint64_t hash_byte(uint64_t hash, unsigned char byte) {
+	return (hash ^ byte) * FNV_PRIME;
+}
+
+static inline uint64_t hash_word(uint64_t hash, uint64_t word) {
+	int shift;
+
+	for (shift = 0; shift < 64; shift += 8)
+		hash = hash_byte(hash, (unsigned char)(word >> shift));
+
+	return hash;
+}
+
+/*
+ * Hashes the same information binary key holds, but directly from
+ * components, so no key buffer is needed: a run of zero components
+ * is hashed as its length along with the following component, and
+ * trailing zeroes are dropped unless a bound flag is set.
+ */
+uint64_t version_hash(const char* v, int flags) {
+	version_iter_t iter;
+	version_component_t component;
+	uint64_t hash = FNV_OFFSET;
+	size_t pending_zeroes = 0, i;
+
+	version_iter_init(&iter, v, flags);
+	while (version_iter_next(&iter, &component)) {
+		if (component.metaorder == VERSIONMETAORDER_ZERO) {
+			pending_zeroes++;
+			continue;
+		}
+
+		hash = hash_word(hash, pending_zeroes);
+		hash = hash_byte(hash, (unsigned char)component.metaorder);
+		pending_zeroes = 0;
+
+		if (component.metaorder == VERSIONMETAORDER_NONZERO) {
+			hash = hash_word(hash, component.length);
+			for (i = 0; i < component.length; i++)
+				hash = hash_byte(hash, v[component.offset + i]);
+		} else {
+			hash = hash_byte(hash, my_tolower(v[component.offset]));
+		}
+	}
+
+	if (flags & VERSIONFLAG_LOWER_BOUND) {
+		hash = hash_word(hash, pending_zeroes);
+		hash = hash_byte(hash, HASH_END_LOWER_BOUND);
+	} else if (flags & VERSIONFLAG_UPPER_BOUND) {
+		hash = hash_word(hash, pending_zeroes);
+		hash = hash_byte(hash, HASH_END_UPPER_BOUND);
+	} else {
+		hash = hash_word(hash, 0);
+		hash = hash_byte(hash, HASH_END);
+	}
+
+	/* FNV leaves low bits poorly mixed, which matters for filters; finalize with splitmix64 mixer */
+	hash ^= hash >> 30;
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	hash ^= hash >> 27;
+	hash *= 0x94d049bb133111ebULL;
+	hash ^= hash >> 31;
+
+	return hash;
+}
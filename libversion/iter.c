@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/version.h>
+
+#include <libversion/private/parse.h>
+#include <libversion/private/string.h>
+
+static void export_component(const version_iter_t* iter, const component_t* component, version_component_t* out) {
+	/* note that zero components are empty, so kind can't be derived from text */
+	switch (component->metaorder) {
+	case METAORDER_ZERO:
+	case METAORDER_NONZERO:
+		out->kind = VERSIONCOMPONENT_NUMERIC;
+		break;
+	default:
+		out->kind = VERSIONCOMPONENT_ALPHABETIC;
+		break;
+	}
+
+	out->metaorder = component->metaorder;
+	out->offset = component->start - iter->start;
+	out->length = component->end - component->start;
+}
+
+void version_iter_init(version_iter_t* iter, const char* v, int flags) {
+	iter->start = v;
+	iter->cursor = v;
+	iter->flags = flags;
+	iter->has_pending = 0;
+}
+
+int version_iter_next(version_iter_t* iter, version_component_t* component) {
+	component_t components[2];
+
+	if (iter->has_pending) {
+		*component = iter->pending;
+		iter->has_pending = 0;
+		return 1;
+	}
+
+	/* unlike comparison, iteration does not produce padding components */
+	iter->cursor = skip_separator(iter->cursor);
+	if (*iter->cursor == '\0')
+		return 0;
+
+	if (get_next_version_component(&iter->cursor, components, iter->flags) == 2) {
+		export_component(iter, &components[1], &iter->pending);
+		iter->has_pending = 1;
+	}
+
+	export_component(iter, &components[0], component);
+	return 1;
+}
+
+size_t version_tokenize(const char* v, int flags, version_component_t* components, size_t capacity) {
+	version_iter_t iter;
+	version_component_t component;
+	size_t count = 0;
+
+	version_iter_init(&iter, v, flags);
+	while (version_iter_next(&iter, &component)) {
+		if (count < capacity)
+			components[count] = component;
+		count++;
+	}
+
+	return count;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/version.h>
+
+#include <string.h>
+
+#include <libversion/private/key.h>
+#include <libversion/private/parse.h>
+#include <libversion/private/string.h>
+
+#define MAX_KEY_SCHEMES 16
+
+size_t version_key(const char* v, int flags, unsigned char* key, size_t capacity) {
+	key_encoder_t encoder;
+	version_iter_t iter;
+	version_component_t component;
+
+	key_encoder_init(&encoder, flags, key, capacity);
+
+	version_iter_init(&iter, v, flags);
+	while (version_iter_next(&iter, &component))
+		key_encoder_push(&encoder, component.metaorder, v + component.offset, component.length);
+
+	return key_encoder_finish(&encoder);
+}
+
+size_t version_key_fixed(const char* v, int flags, unsigned char* key, size_t width) {
+	size_t length;
+
+	if (width == 0)
+		return version_key(v, flags, NULL, 0);
+
+	memset(key, 0, width);
+
+	length = version_key(v, flags, key, width - 1);
+	key[width - 1] = length > width - 1;
+
+	return length;
+}
+
+size_t version_key_multi(const char* v, const int* flags, size_t count, unsigned char* const* keys, size_t capacity, size_t* lengths) {
+	key_encoder_t encoders[MAX_KEY_SCHEMES];
+	component_t components[2];
+	const char* cursor;
+	size_t num_components, icomponent, i, max_length = 0;
+	int metaorder;
+
+	/* larger numbers of schemes are processed in batches */
+	if (count > MAX_KEY_SCHEMES) {
+		max_length = version_key_multi(v, flags + MAX_KEY_SCHEMES, count - MAX_KEY_SCHEMES, keys + MAX_KEY_SCHEMES, capacity, lengths + MAX_KEY_SCHEMES);
+		count = MAX_KEY_SCHEMES;
+	}
+
+	for (i = 0; i < count; i++)
+		key_encoder_init(&encoders[i], flags[i], keys[i], capacity);
+
+	/* splitting into components does not depend on flags, so it's done once with default ones */
+	for (cursor = skip_separator(v); *cursor != '\0'; cursor = skip_separator(cursor)) {
+		num_components = get_next_version_component(&cursor, components, 0);
+
+		for (icomponent = 0; icomponent < num_components; icomponent++) {
+			for (i = 0; i < count; i++) {
+				metaorder = components[icomponent].metaorder;
+
+				/* but keyword classification does, which is only redone for alphabetic components; second one is always a letter suffix */
+				if (metaorder != METAORDER_ZERO && metaorder != METAORDER_NONZERO && (flags[i] & (VERSIONFLAG_P_IS_PATCH | VERSIONFLAG_ANY_IS_PATCH)))
+					metaorder = get_alpha_component_metaorder(components[icomponent].start, components[icomponent].end, flags[i], icomponent == 1);
+
+				key_encoder_push(&encoders[i], metaorder, components[icomponent].start, components[icomponent].end - components[icomponent].start);
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		lengths[i] = key_encoder_finish(&encoders[i]);
+		if (lengths[i] > max_length)
+			max_length = lengths[i];
+	}
+
+	return max_length;
+}
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/keydict.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/key.h>
+
+#define MAX_PATTERNS 127
+#define MAX_CODES (2 * MAX_PATTERNS + 1)
+#define MAX_PATTERN_COMPONENTS 8
+#define MAX_PATTERN_LENGTH 64
+#define MAX_TRAINING_KEYS 4096
+#define NO_PATTERN -1
+
+/*
+ * Compression replaces key prefixes found in the dictionary with
+ * single byte codes, and escapes other components with a code byte
+ * followed by the raw component.
+ *
+ * Dictionary patterns are sequences of whole components, which may
+ * be prefixes of each other. Consider sorted patterns as boundaries
+ * which split the space of keys into intervals: each pattern p opens
+ * an interval of keys starting with p, and closes it after the last
+ * key starting with p. 2n boundaries produce 2n + 1 intervals, and
+ * the code for a key is the index of the interval it falls into.
+ * Keys in an interval either share the same longest matching pattern
+ * (which is then consumed), or have no matching pattern at all (in
+ * which case the first component is consumed and written raw after
+ * the code). In both cases comparing codes orders keys from different
+ * intervals, and keys from the same interval are ordered by what
+ * follows, so memcmp of compressed keys gives the same result as
+ * memcmp of original keys.
+ */
+struct version_keydict {
+	size_t count;
+	const unsigned char* patterns[MAX_PATTERNS];
+	size_t lengths[MAX_PATTERNS];
+	int parents[MAX_PATTERNS];          /* longest pattern which is a prefix of this one */
+	int depths[MAX_PATTERNS];           /* number of patterns which are prefixes of this one, including itself */
+	int decode[MAX_CODES];              /* pattern consumed by each code, NO_PATTERN for escaped component */
+	unsigned char* storage;
+};
+
+typedef struct {
+	const unsigned char* data;
+	size_t length;
+	size_t count;
+} candidate_t;
+
+static inline int is_prefix(const unsigned char* p, size_t plen, const unsigned char* s, size_t slen) {
+	return plen <= slen && memcmp(p, s, plen) == 0;
+}
+
+static version_keydict_t* build_dict(const unsigned char* const* patterns, const size_t* lengths, size_t count) {
+	version_keydict_t* dict;
+	unsigned char* storage;
+	size_t i, total = 0;
+	int current = NO_PATTERN, code = 0;
+
+	if (count > MAX_PATTERNS)
+		return NULL;
+
+	/* patterns must be strictly ordered and non-empty */
+	for (i = 0; i < count; i++) {
+		if (lengths[i] == 0 || (i > 0 && key_compare(patterns[i - 1], lengths[i - 1], patterns[i], lengths[i]) >= 0))
+			return NULL;
+		total += lengths[i];
+	}
+
+	if ((dict = malloc(sizeof(version_keydict_t))) == NULL)
+		return NULL;
+	if ((dict->storage = malloc(total > 0 ? total : 1)) == NULL) {
+		free(dict);
+		return NULL;
+	}
+
+	dict->count = count;
+
+	storage = dict->storage;
+	for (i = 0; i < count; i++) {
+		memcpy(storage, patterns[i], lengths[i]);
+		dict->patterns[i] = storage;
+		dict->lengths[i] = lengths[i];
+		storage += lengths[i];
+	}
+
+	/* walk boundaries in order, keeping the chain of open patterns */
+	dict->decode[code] = NO_PATTERN;
+	for (i = 0; i < count; i++) {
+		while (current != NO_PATTERN && !is_prefix(dict->patterns[current], dict->lengths[current], dict->patterns[i], dict->lengths[i])) {
+			current = dict->parents[current];
+			dict->decode[++code] = current;
+		}
+		dict->parents[i] = current;
+		dict->depths[i] = current == NO_PATTERN ? 1 : dict->depths[current] + 1;
+		current = (int)i;
+		dict->decode[++code] = current;
+	}
+	while (current != NO_PATTERN) {
+		current = dict->parents[current];
+		dict->decode[++code] = current;
+	}
+
+	return dict;
+}
+
+static uint64_t hash_bytes(const unsigned char* data, size_t length) {
+	uint64_t hash = 14695981039346656037ULL;
+
+	while (length-- > 0)
+		hash = (hash ^ *data++) * 1099511628211ULL;
+
+	return hash;
+}
+
+static size_t count_components(const unsigned char* key, size_t length) {
+	size_t count = 0, pos = 0;
+
+	while (pos < length) {
+		pos += key_component_length(key + pos, length - pos);
+		count++;
+	}
+
+	return count;
+}
+
+static void count_candidate(candidate_t* table, size_t mask, const unsigned char* data, size_t length) {
+	size_t slot = (size_t)hash_bytes(data, length) & mask;
+
+	while (table[slot].data != NULL && (table[slot].length != length || memcmp(table[slot].data, data, length) != 0))
+		slot = (slot + 1) & mask;
+
+	table[slot].data = data;
+	table[slot].length = length;
+	table[slot].count++;
+}
+
+static int compare_candidates_by_gain(const void* a, const void* b) {
+	const candidate_t* ca = (const candidate_t*)a;
+	const candidate_t* cb = (const candidate_t*)b;
+	size_t ga = ca->count * ca->length, gb = cb->count * cb->length;
+
+	if (ga != gb)
+		return ga > gb ? -1 : 1;
+	return key_compare(ca->data, ca->length, cb->data, cb->length);
+}
+
+static int compare_candidates_by_data(const void* a, const void* b) {
+	const candidate_t* ca = (const candidate_t*)a;
+	const candidate_t* cb = (const candidate_t*)b;
+
+	return key_compare(ca->data, ca->length, cb->data, cb->length);
+}
+
+version_keydict_t* version_keydict_train(const unsigned char* const* keys, const size_t* lengths, size_t count) {
+	const unsigned char* patterns[MAX_PATTERNS];
+	size_t pattern_lengths[MAX_PATTERNS];
+	candidate_t* table;
+	version_keydict_t* dict;
+	size_t num_sampled = count < MAX_TRAINING_KEYS ? count : MAX_TRAINING_KEYS;
+	size_t step = num_sampled > 0 ? count / num_sampled : 1;
+	size_t max_candidates = 0, capacity = 16, num_candidates = 0, i, j;
+	size_t start, end, num_components;
+	const unsigned char* key;
+	size_t length;
+
+	for (i = 0; i < num_sampled; i++)
+		max_candidates += count_components(keys[i * step], lengths[i * step]) * MAX_PATTERN_COMPONENTS;
+
+	while (capacity < max_candidates * 2)
+		capacity *= 2;
+
+	if ((table = calloc(capacity, sizeof(candidate_t))) == NULL)
+		return NULL;
+
+	/* count every sequence of whole components which may become a pattern */
+	for (i = 0; i < num_sampled; i++) {
+		key = keys[i * step];
+		length = lengths[i * step];
+		for (start = 0; start < length; start += key_component_length(key + start, length - start)) {
+			end = start;
+			for (num_components = 0; num_components < MAX_PATTERN_COMPONENTS && end < length; num_components++) {
+				end += key_component_length(key + end, length - end);
+				if (end - start > MAX_PATTERN_LENGTH)
+					break;
+				count_candidate(table, capacity - 1, key + start, end - start);
+			}
+		}
+	}
+
+	/* patterns which save the most bytes win; escaping a component costs an extra byte, so even single byte patterns pay off */
+	for (i = 0; i < capacity; i++)
+		if (table[i].count >= 2)
+			table[num_candidates++] = table[i];
+
+	qsort(table, num_candidates, sizeof(candidate_t), compare_candidates_by_gain);
+	if (num_candidates > MAX_PATTERNS)
+		num_candidates = MAX_PATTERNS;
+	qsort(table, num_candidates, sizeof(candidate_t), compare_candidates_by_data);
+
+	for (j = 0; j < num_candidates; j++) {
+		patterns[j] = table[j].data;
+		pattern_lengths[j] = table[j].length;
+	}
+
+	dict = build_dict(patterns, pattern_lengths, num_candidates);
+
+	free(table);
+	return dict;
+}
+
+void version_keydict_free(version_keydict_t* dict) {
+	if (dict == NULL)
+		return;
+
+	free(dict->storage);
+	free(dict);
+}
+
+size_t version_keydict_compress(const version_keydict_t* dict, const unsigned char* key, size_t length, unsigned char* out, size_t capacity) {
+	size_t pos = 0, out_length = 0, consumed, left, right, middle, i;
+	const unsigned char* rest;
+	size_t rest_length;
+	int match;
+
+	while (pos < length) {
+		rest = key + pos;
+		rest_length = length - pos;
+
+		/* number of patterns not greater than the rest of the key */
+		left = 0;
+		right = dict->count;
+		while (left < right) {
+			middle = left + (right - left) / 2;
+			if (key_compare(dict->patterns[middle], dict->lengths[middle], rest, rest_length) <= 0)
+				left = middle + 1;
+			else
+				right = middle;
+		}
+
+		/* longest matching pattern is the greatest one which is not greater, or one of its prefixes */
+		match = (int)left - 1;
+		while (match != NO_PATTERN && !is_prefix(dict->patterns[match], dict->lengths[match], rest, rest_length))
+			match = dict->parents[match];
+
+		if (match != NO_PATTERN) {
+			if (out_length < capacity)
+				out[out_length] = (unsigned char)(2 * left - dict->depths[match]);
+			out_length++;
+			consumed = dict->lengths[match];
+		} else {
+			if (out_length < capacity)
+				out[out_length] = (unsigned char)(2 * left);
+			out_length++;
+			consumed = key_component_length(rest, rest_length);
+			for (i = 0; i < consumed; i++, out_length++)
+				if (out_length < capacity)
+					out[out_length] = rest[i];
+		}
+
+		pos += consumed;
+	}
+
+	return out_length;
+}
+
+size_t version_keydict_decompress(const version_keydict_t* dict, const unsigned char* ckey, size_t length, unsigned char* out, size_t capacity) {
+	size_t pos = 0, out_length = 0, i, chunk_length;
+	const unsigned char* chunk;
+	int pattern;
+
+	while (pos < length) {
+		if (ckey[pos] > 2 * dict->count)
+			return 0;
+
+		pattern = dict->decode[ckey[pos++]];
+		if (pattern != NO_PATTERN) {
+			chunk = dict->patterns[pattern];
+			chunk_length = dict->lengths[pattern];
+		} else {
+			if (pos == length)
+				return 0;
+			chunk = ckey + pos;
+			chunk_length = key_component_length(chunk, length - pos);
+			pos += chunk_length;
+		}
+
+		for (i = 0; i < chunk_length; i++, out_length++)
+			if (out_length < capacity)
+				out[out_length] = chunk[i];
+	}
+
+	return out_length;
+}
+
+/*
+ * Serialized dictionary is a byte holding number of patterns,
+ * followed by each pattern as a length byte and pattern bytes.
+ */
+size_t version_keydict_serialize(const version_keydict_t* dict, unsigned char* out, size_t capacity) {
+	size_t out_length = 0, i, j;
+
+	if (out_length < capacity)
+		out[out_length] = (unsigned char)dict->count;
+	out_length++;
+
+	for (i = 0; i < dict->count; i++) {
+		if (out_length < capacity)
+			out[out_length] = (unsigned char)dict->lengths[i];
+		out_length++;
+		for (j = 0; j < dict->lengths[i]; j++, out_length++)
+			if (out_length < capacity)
+				out[out_length] = dict->patterns[i][j];
+	}
+
+	return out_length;
+}
+
+version_keydict_t* version_keydict_deserialize(const unsigned char* data, size_t length) {
+	const unsigned char* patterns[MAX_PATTERNS];
+	size_t pattern_lengths[MAX_PATTERNS];
+	size_t count, pos = 1, i;
+
+	if (length == 0 || (count = data[0]) > MAX_PATTERNS)
+		return NULL;
+
+	for (i = 0; i < count; i++) {
+		if (pos == length || length - pos - 1 < data[pos])
+			return NULL;
+		pattern_lengths[i] = data[pos++];
+		patterns[i] = data + pos;
+		pos += pattern_lengths[i];
+	}
+
+	if (pos != length)
+		return NULL;
+
+	return build_dict(patterns, pattern_lengths, count);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_KEYDICT_H
+#define LIBVERSION_KEYDICT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include <libversion/version.h>
+
+typedef struct version_keydict version_keydict_t;
+
+/* upper limit of compressed key length for a key of given length */
+#define VERSION_KEYDICT_MAX_LENGTH(len) (2 * (len))
+
+extern LIBVERSION_EXPORT version_keydict_t* version_keydict_train(const unsigned char* const* keys, const size_t* lengths, size_t count);
+extern LIBVERSION_EXPORT void version_keydict_free(version_keydict_t* dict);
+
+extern LIBVERSION_EXPORT size_t version_keydict_compress(const version_keydict_t* dict, const unsigned char* key, size_t length, unsigned char* out, size_t capacity);
+extern LIBVERSION_EXPORT size_t version_keydict_decompress(const version_keydict_t* dict, const unsigned char* ckey, size_t length, unsigned char* out, size_t capacity);
+
+extern LIBVERSION_EXPORT size_t version_keydict_serialize(const version_keydict_t* dict, unsigned char* out, size_t capacity);
+extern LIBVERSION_EXPORT version_keydict_t* version_keydict_deserialize(const unsigned char* data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBVERSION_KEYDICT_H */
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/outdated.h>
+#include <libversion/sort.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/component.h>
+#include <libversion/private/key.h>
+#include <libversion/private/parallel.h>
+
+#define TASKS_PER_THREAD 4
+
+typedef struct {
+	version_outdated_row_t* row;
+	size_t key_offset;
+	size_t key_length;
+	size_t upper_offset;       /* upper bound of the release branch */
+	size_t upper_length;
+} entry_t;
+
+typedef struct {
+	version_outdated_row_t** rows;      /* grouped by package */
+	size_t* task_bounds;
+	int* task_failed;
+	int flags;
+	int branch_depth;
+} classifier_t;
+
+/* per task buffers, reused for all packages of the task */
+typedef struct {
+	entry_t* entries;
+	version_sort_item_t* items;
+	size_t capacity;
+	unsigned char* keys;
+	size_t keys_capacity;
+} workspace_t;
+
+/* encodes upper bound of the release branch from the components of the version as they were parsed */
+typedef struct {
+	int branch_depth;
+	int num_components;
+	key_encoder_t upper;
+} branch_finder_t;
+
+static void find_branch(const version_component_t* component, const char* text, void* userdata) {
+	branch_finder_t* finder = (branch_finder_t*)userdata;
+
+	if (++finder->num_components <= finder->branch_depth)
+		key_encoder_push(&finder->upper, component->metaorder, text, component->length);
+}
+
+static int compare_packages(const void* a, const void* b) {
+	const version_outdated_row_t* ra = *(const version_outdated_row_t* const*)a;
+	const version_outdated_row_t* rb = *(const version_outdated_row_t* const*)b;
+
+	return key_compare((const unsigned char*)ra->package, ra->package_length, (const unsigned char*)rb->package, rb->package_length);
+}
+
+static int same_package(const version_outdated_row_t* a, const version_outdated_row_t* b) {
+	return a->package_length == b->package_length && memcmp(a->package, b->package, a->package_length) == 0;
+}
+
+static int reserve_workspace(workspace_t* workspace, size_t count, size_t keys_length) {
+	entry_t* entries;
+	version_sort_item_t* items;
+	unsigned char* keys;
+
+	if (count > workspace->capacity) {
+		if ((entries = realloc(workspace->entries, count * sizeof(entry_t))) == NULL)
+			return 0;
+		workspace->entries = entries;
+		if ((items = realloc(workspace->items, count * sizeof(version_sort_item_t))) == NULL)
+			return 0;
+		workspace->items = items;
+		workspace->capacity = count;
+	}
+
+	if (keys_length > workspace->keys_capacity) {
+		if ((keys = realloc(workspace->keys, keys_length)) == NULL)
+			return 0;
+		workspace->keys = keys;
+		workspace->keys_capacity = keys_length;
+	}
+
+	return 1;
+}
+
+static int classify_package(const classifier_t* classifier, workspace_t* workspace, version_outdated_row_t** rows, size_t count) {
+	version_stream_t stream;
+	branch_finder_t finder;
+	entry_t* entry;
+	const unsigned char* newest = NULL;
+	const unsigned char* key;
+	const unsigned char* upper;
+	size_t newest_length = 0, keys_length = 0, max_key_length, i, left, right, middle;
+	int depth;
+
+	for (i = 0; i < count; i++)
+		keys_length += 2 * VERSION_KEY_MAX_LENGTH(rows[i]->version_length) + 2 * (size_t)classifier->branch_depth;
+
+	if (!reserve_workspace(workspace, count, keys_length))
+		return 0;
+
+	/*
+	 * parse each version once, encoding its release branch upper bound
+	 * on the way; re-parsing truncated text would not do, as classification
+	 * of the last branch component may depend on what follows it (e.g.
+	 * a in 1a1 is a pre-release, but in 1a it's a letter suffix)
+	 */
+	keys_length = 0;
+	for (i = 0; i < count; i++) {
+		entry = &workspace->entries[i];
+		entry->row = rows[i];
+		max_key_length = VERSION_KEY_MAX_LENGTH(rows[i]->version_length);
+
+		/* upper bound is built after the space reserved for the key, and moved next to it afterwards */
+		finder.branch_depth = classifier->branch_depth;
+		finder.num_components = 0;
+		key_encoder_init(&finder.upper, classifier->flags | VERSIONFLAG_UPPER_BOUND, workspace->keys + keys_length + max_key_length, workspace->keys_capacity - keys_length - max_key_length);
+
+		version_stream_init(&stream, classifier->flags, workspace->keys + keys_length, max_key_length);
+		version_stream_set_callback(&stream, find_branch, &finder);
+		version_stream_feed(&stream, rows[i]->version, rows[i]->version_length);
+		entry->key_offset = keys_length;
+		entry->key_length = version_stream_finish(&stream);
+		if (entry->key_length == 0)
+			return 0;
+		keys_length += entry->key_length;
+
+		entry->upper_offset = keys_length;
+		entry->upper_length = 0;
+		if (classifier->branch_depth > 0) {
+			/* versions shorter than the branch are implicitly padded with zeroes, e.g. 1 is in 1.0 branch */
+			for (depth = finder.num_components; depth < classifier->branch_depth; depth++)
+				key_encoder_push(&finder.upper, METAORDER_ZERO, "", 0);
+			entry->upper_length = key_encoder_finish(&finder.upper);
+			memmove(workspace->keys + keys_length, workspace->keys + entry->key_offset + max_key_length, entry->upper_length);
+			keys_length += entry->upper_length;
+		}
+
+		key = workspace->keys + entry->key_offset;
+		if (newest == NULL || key_compare(key, entry->key_length, newest, newest_length) > 0) {
+			newest = key;
+			newest_length = entry->key_length;
+		}
+
+		workspace->items[i].key = key;
+		workspace->items[i].key_length = entry->key_length;
+		workspace->items[i].text = NULL;
+		workspace->items[i].text_length = 0;
+	}
+
+	if (classifier->branch_depth > 0)
+		version_sort_items(workspace->items, count, VERSIONSORT_AUTO);
+
+	for (i = 0; i < count; i++) {
+		entry = &workspace->entries[i];
+		key = workspace->keys + entry->key_offset;
+
+		if (key_compare(key, entry->key_length, newest, newest_length) == 0) {
+			entry->row->status = VERSIONSTATUS_NEWEST;
+			continue;
+		}
+
+		entry->row->status = VERSIONSTATUS_OUTDATED;
+		if (classifier->branch_depth == 0)
+			continue;
+
+		/* newest version of the branch is the last one not above branch upper bound */
+		upper = workspace->keys + entry->upper_offset;
+		left = 0;
+		right = count;
+		while (left < right) {
+			middle = left + (right - left) / 2;
+			if (key_compare(workspace->items[middle].key, workspace->items[middle].key_length, upper, entry->upper_length) <= 0)
+				left = middle + 1;
+			else
+				right = middle;
+		}
+
+		if (left > 0 && key_compare(workspace->items[left - 1].key, workspace->items[left - 1].key_length, key, entry->key_length) == 0)
+			entry->row->status = VERSIONSTATUS_LEGACY;
+	}
+
+	return 1;
+}
+
+static void classify_task(size_t task, void* context) {
+	const classifier_t* classifier = (const classifier_t*)context;
+	workspace_t workspace;
+	size_t start = classifier->task_bounds[task], end = classifier->task_bounds[task + 1], next;
+	int failed = 0;
+
+	memset(&workspace, 0, sizeof(workspace));
+
+	for (; start < end && !failed; start = next) {
+		next = start + 1;
+		while (next < end && same_package(classifier->rows[start], classifier->rows[next]))
+			next++;
+		failed = !classify_package(classifier, &workspace, classifier->rows + start, next - start);
+	}
+
+	free(workspace.entries);
+	free(workspace.items);
+	free(workspace.keys);
+
+	classifier->task_failed[task] = failed;
+}
+
+int version_outdated_classify(version_outdated_row_t* rows, size_t count, int flags, int branch_depth, int threads) {
+	classifier_t classifier;
+	size_t num_threads, num_tasks, task, i, bound;
+	int failed = 0;
+
+	if (count == 0)
+		return 1;
+
+	num_threads = parallel_resolve_threads(threads);
+	num_tasks = num_threads > 1 ? num_threads * TASKS_PER_THREAD : 1;
+	if (num_tasks > count)
+		num_tasks = count;
+
+	classifier.rows = malloc(count * sizeof(version_outdated_row_t*));
+	classifier.task_bounds = malloc((num_tasks + 1) * sizeof(size_t));
+	classifier.task_failed = calloc(num_tasks, sizeof(int));
+	classifier.flags = flags & ~(VERSIONFLAG_LOWER_BOUND | VERSIONFLAG_UPPER_BOUND);
+	classifier.branch_depth = branch_depth > 0 ? branch_depth : 0;
+
+	if (classifier.rows == NULL || classifier.task_bounds == NULL || classifier.task_failed == NULL) {
+		free(classifier.rows);
+		free(classifier.task_bounds);
+		free(classifier.task_failed);
+		return 0;
+	}
+
+	for (i = 0; i < count; i++)
+		classifier.rows[i] = &rows[i];
+	qsort(classifier.rows, count, sizeof(version_outdated_row_t*), compare_packages);
+
+	/* split rows into tasks of similar size, never splitting a package */
+	classifier.task_bounds[0] = 0;
+	for (task = 1; task < num_tasks; task++) {
+		bound = count / num_tasks * task;
+		if (bound < classifier.task_bounds[task - 1])
+			bound = classifier.task_bounds[task - 1];
+		while (bound > 0 && bound < count && same_package(classifier.rows[bound - 1], classifier.rows[bound]))
+			bound++;
+		classifier.task_bounds[task] = bound;
+	}
+	classifier.task_bounds[num_tasks] = count;
+
+	parallel_run(num_tasks, num_threads, classify_task, &classifier);
+
+	for (task = 0; task < num_tasks; task++)
+		failed |= classifier.task_failed[task];
+
+	free(classifier.rows);
+	free(classifier.task_bounds);
+	free(classifier.task_failed);
+
+	return !failed;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_OUTDATED_H
+#define LIBVERSION_OUTDATED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include <libversion/version.h>
+
+enum {
+	VERSIONSTATUS_NEWEST,
+	VERSIONSTATUS_OUTDATED,
+	VERSIONSTATUS_LEGACY,     /* outdated, but newest in its release branch */
+};
+
+typedef struct {
+	const char* package;
+	size_t package_length;
+	const char* version;
+	size_t version_length;
+	int status;               /* filled by classification */
+} version_outdated_row_t;
+
+extern LIBVERSION_EXPORT int version_outdated_classify(version_outdated_row_t* rows, size_t count, int flags, int branch_depth, int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBVERSION_OUTDATED_H */
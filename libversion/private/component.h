@@ -23,14 +23,17 @@
 #ifndef LIBVERSION_PRIVATE_COMPONENT_H
 #define LIBVERSION_PRIVATE_COMPONENT_H
 
+#include <libversion/version.h>
+
+/* values match public VERSIONMETAORDER_* constants */
 enum {
-	METAORDER_LOWER_BOUND,
-	METAORDER_PRE_RELEASE,
-	METAORDER_ZERO,
-	METAORDER_POST_RELEASE,
-	METAORDER_NONZERO,
-	METAORDER_LETTER_SUFFIX,
-	METAORDER_UPPER_BOUND,
+	METAORDER_LOWER_BOUND = VERSIONMETAORDER_LOWER_BOUND,
+	METAORDER_PRE_RELEASE = VERSIONMETAORDER_PRE_RELEASE,
+	METAORDER_ZERO = VERSIONMETAORDER_ZERO,
+	METAORDER_POST_RELEASE = VERSIONMETAORDER_POST_RELEASE,
+	METAORDER_NONZERO = VERSIONMETAORDER_NONZERO,
+	METAORDER_LETTER_SUFFIX = VERSIONMETAORDER_LETTER_SUFFIX,
+	METAORDER_UPPER_BOUND = VERSIONMETAORDER_UPPER_BOUND,
 };
 
 typedef struct {
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/private/file.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LIBVERSION_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+int file_data_load(file_data_t* file, const char* path) {
+#ifdef LIBVERSION_HAVE_MMAP
+	struct stat st;
+	int fd;
+	void* data;
+#else
+	FILE* f;
+	char buffer[65536];
+	size_t nread;
+	char* data;
+#endif
+
+	file->data = NULL;
+	file->length = 0;
+	file->mapped = 0;
+
+#ifdef LIBVERSION_HAVE_MMAP
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return 0;
+
+	if (fstat(fd, &st) == -1) {
+		close(fd);
+		return 0;
+	}
+
+	if (st.st_size == 0) {
+		close(fd);
+		return 1;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return 0;
+
+	file->data = data;
+	file->length = st.st_size;
+	file->mapped = 1;
+	return 1;
+#else
+	f = fopen(path, "rb");
+	if (f == NULL)
+		return 0;
+
+	while ((nread = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		data = realloc(file->data, file->length + nread);
+		if (data == NULL) {
+			fclose(f);
+			file_data_release(file);
+			errno = ENOMEM;
+			return 0;
+		}
+		memcpy(data + file->length, buffer, nread);
+		file->data = data;
+		file->length += nread;
+	}
+
+	if (ferror(f)) {
+		fclose(f);
+		file_data_release(file);
+		return 0;
+	}
+
+	fclose(f);
+	return 1;
+#endif
+}
+
+void file_data_release(file_data_t* file) {
+#ifdef LIBVERSION_HAVE_MMAP
+	if (file->mapped)
+		munmap(file->data, file->length);
+	else
+#endif
+	free(file->data);
+
+	file->data = NULL;
+	file->length = 0;
+	file->mapped = 0;
+}
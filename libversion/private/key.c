@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/private/key.h>
+
+#include <libversion/private/component.h>
+#include <libversion/private/string.h>
+
+static inline void put_byte(key_encoder_t* encoder, unsigned char byte) {
+	if (encoder->length < encoder->capacity)
+		encoder->buffer[encoder->length] = byte;
+	encoder->length++;
+}
+
+static void put_number(key_encoder_t* encoder, const char* digits, size_t length) {
+	size_t i;
+	int shift;
+
+	if (length == 1) {
+		put_byte(encoder, KEY_NUMBER_DIGIT + (digits[0] - '0'));
+		return;
+	}
+
+	if (length <= KEY_NUMBER_SHORT_MAX_DIGITS) {
+		put_byte(encoder, KEY_NUMBER_SHORT + (length - KEY_NUMBER_SHORT_MIN_DIGITS));
+	} else {
+		put_byte(encoder, KEY_NUMBER_LONG);
+		for (shift = 56; shift >= 0; shift -= 8)
+			put_byte(encoder, (unsigned char)((unsigned long long)length >> shift));
+	}
+
+	/* numbers of equal length compare the same way as their BCD representations */
+	for (i = 0; i + 1 < length; i += 2)
+		put_byte(encoder, ((digits[i] - '0') << 4) | (digits[i + 1] - '0'));
+	if (i < length)
+		put_byte(encoder, (digits[i] - '0') << 4);
+}
+
+static void flush_zeroes(key_encoder_t* encoder, int next_metaorder) {
+	unsigned char byte = next_metaorder < METAORDER_ZERO ? KEY_ZERO_BEFORE_LOWER : KEY_ZERO_BEFORE_HIGHER;
+
+	for (; encoder->pending_zeroes > 0; encoder->pending_zeroes--)
+		put_byte(encoder, byte);
+}
+
+void key_encoder_init(key_encoder_t* encoder, int flags, unsigned char* buffer, size_t capacity) {
+	encoder->buffer = buffer;
+	encoder->capacity = capacity;
+	encoder->length = 0;
+	encoder->pending_zeroes = 0;
+	encoder->flags = flags;
+}
+
+void key_encoder_push(key_encoder_t* encoder, int metaorder, const char* text, size_t length) {
+	if (metaorder == METAORDER_ZERO) {
+		encoder->pending_zeroes++;
+		return;
+	}
+
+	flush_zeroes(encoder, metaorder);
+
+	switch (metaorder) {
+	case METAORDER_PRE_RELEASE:
+		put_byte(encoder, KEY_PRE_RELEASE);
+		put_byte(encoder, my_tolower(*text));
+		break;
+	case METAORDER_POST_RELEASE:
+		put_byte(encoder, KEY_POST_RELEASE);
+		put_byte(encoder, my_tolower(*text));
+		break;
+	case METAORDER_NONZERO:
+		put_number(encoder, text, length);
+		break;
+	case METAORDER_LETTER_SUFFIX:
+		put_byte(encoder, KEY_LETTER_SUFFIX);
+		put_byte(encoder, my_tolower(*text));
+		break;
+	}
+}
+
+void key_encoder_push_number(key_encoder_t* encoder, const char* digits, size_t length) {
+	if (length == 0)
+		put_byte(encoder, KEY_NUMBER_DIGIT);
+	else
+		put_number(encoder, digits, length);
+}
+
+size_t key_encoder_finish(key_encoder_t* encoder) {
+	/* padding component acts as the following non-zero component for pending zeroes */
+	if (encoder->flags & VERSIONFLAG_LOWER_BOUND) {
+		flush_zeroes(encoder, METAORDER_LOWER_BOUND);
+		put_byte(encoder, KEY_END_LOWER_BOUND);
+	} else if (encoder->flags & VERSIONFLAG_UPPER_BOUND) {
+		flush_zeroes(encoder, METAORDER_UPPER_BOUND);
+		put_byte(encoder, KEY_END_UPPER_BOUND);
+	} else {
+		/* trailing zeroes are indistinguishable from padding */
+		encoder->pending_zeroes = 0;
+		put_byte(encoder, KEY_END);
+	}
+
+	return encoder->length;
+}
+
+size_t key_component_length(const unsigned char* key, size_t length) {
+	size_t result = 1, digits = 0;
+	int i;
+
+	if (length == 0)
+		return 0;
+
+	switch (key[0]) {
+	case KEY_PRE_RELEASE:
+	case KEY_POST_RELEASE:
+	case KEY_LETTER_SUFFIX:
+		result = 2;
+		break;
+	case KEY_NUMBER_LONG:
+		for (i = 1; i <= 8 && (size_t)i < length; i++)
+			digits = (digits << 8) | key[i];
+		result = 9 + (digits + 1) / 2;
+		break;
+	default:
+		if (key[0] >= KEY_NUMBER_SHORT && key[0] < KEY_NUMBER_LONG)
+			result = 1 + (key[0] - KEY_NUMBER_SHORT + KEY_NUMBER_SHORT_MIN_DIGITS + 1) / 2;
+		break;
+	}
+
+	return result < length ? result : length;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_PRIVATE_KEY_H
+#define LIBVERSION_PRIVATE_KEY_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include <libversion/version.h>
+
+/*
+ * Binary key layout
+ *
+ * Each component is encoded as a class byte, optionally followed by
+ * payload. Class bytes are ordered the same way as metaorders, so
+ * memcmp() of two keys gives the same result as version_compare4().
+ *
+ * Zero components are the tricky part, as the version is implicitly
+ * padded with zeroes, and whether a zero is less or greater than
+ * the end of the other version depends on the first non-zero
+ * component which follows it. Thus, zero components are encoded
+ * with one of two class bytes surrounding KEY_END, depending on
+ * the metaorder of the following non-zero component, and trailing
+ * zeroes are dropped altogether.
+ */
+enum {
+	KEY_END_LOWER_BOUND = 0x01,
+	KEY_PRE_RELEASE = 0x02,        /* followed by lowercase first letter */
+	KEY_ZERO_BEFORE_LOWER = 0x03,
+	KEY_END = 0x04,
+	KEY_ZERO_BEFORE_HIGHER = 0x05,
+	KEY_POST_RELEASE = 0x06,       /* followed by lowercase first letter */
+	KEY_NUMBER_DIGIT = 0x10,       /* 0x11..0x19 are single digit numbers */
+	KEY_NUMBER_SHORT = 0x20,       /* 0x20..0xef followed by BCD digits of 2..209 digit numbers */
+	KEY_NUMBER_LONG = 0xf0,        /* followed by 8 byte big endian length and BCD digits */
+	KEY_LETTER_SUFFIX = 0xfd,      /* followed by lowercase first letter */
+	KEY_END_UPPER_BOUND = 0xfe,
+};
+
+#define KEY_NUMBER_SHORT_MIN_DIGITS 2
+#define KEY_NUMBER_SHORT_MAX_DIGITS (KEY_NUMBER_LONG - KEY_NUMBER_SHORT + KEY_NUMBER_SHORT_MIN_DIGITS - 1)
+
+typedef version_key_encoder_t key_encoder_t;
+
+/* keys are prefix free, so length only matters if one key is a prefix of another, e.g. for truncated keys */
+static inline int key_compare(const unsigned char* k1, size_t l1, const unsigned char* k2, size_t l2) {
+	int res = memcmp(k1, k2, l1 < l2 ? l1 : l2);
+	if (res != 0)
+		return res < 0 ? -1 : 1;
+	return l1 < l2 ? -1 : l1 > l2 ? 1 : 0;
+}
+
+void key_encoder_init(key_encoder_t* encoder, int flags, unsigned char* buffer, size_t capacity);
+void key_encoder_push(key_encoder_t* encoder, int metaorder, const char* text, size_t length);
+size_t key_encoder_finish(key_encoder_t* encoder);
+
+/* encodes a standalone number, zero included; digits must not have leading zeroes */
+void key_encoder_push_number(key_encoder_t* encoder, const char* digits, size_t length);
+
+/* length of encoded component starting at key, clipped to the key length */
+size_t key_component_length(const unsigned char* key, size_t length);
+
+#endif /* LIBVERSION_PRIVATE_KEY_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/private/parallel.h>
+
+#ifdef LIBVERSION_HAVE_PTHREAD
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+#define MAX_THREADS 256
+
+size_t parallel_resolve_threads(int threads) {
+	if (threads > MAX_THREADS)
+		return MAX_THREADS;
+	if (threads > 0)
+		return threads;
+
+#if defined(LIBVERSION_HAVE_PTHREAD) && defined(_SC_NPROCESSORS_ONLN)
+	{
+		long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+		if (ncpus > MAX_THREADS)
+			return MAX_THREADS;
+		if (ncpus > 0)
+			return ncpus;
+	}
+#endif
+
+	return 1;
+}
+
+typedef struct {
+	size_t first_task;
+	size_t num_tasks;
+	size_t stride;
+	parallel_task_t task;
+	void* context;
+} worker_t;
+
+static void run_worker(const worker_t* worker) {
+	size_t i;
+
+	for (i = worker->first_task; i < worker->num_tasks; i += worker->stride)
+		worker->task(i, worker->context);
+}
+
+#ifdef LIBVERSION_HAVE_PTHREAD
+static void* worker_thread(void* arg) {
+	run_worker((const worker_t*)arg);
+	return NULL;
+}
+#endif
+
+void parallel_run(size_t num_tasks, size_t num_threads, parallel_task_t task, void* context) {
+	worker_t workers[MAX_THREADS];
+	size_t i;
+
+	if (num_threads > num_tasks)
+		num_threads = num_tasks;
+	if (num_threads > MAX_THREADS)
+		num_threads = MAX_THREADS;
+	if (num_threads == 0)
+		return;
+
+	for (i = 0; i < num_threads; i++) {
+		workers[i].first_task = i;
+		workers[i].num_tasks = num_tasks;
+		workers[i].stride = num_threads;
+		workers[i].task = task;
+		workers[i].context = context;
+	}
+
+#ifdef LIBVERSION_HAVE_PTHREAD
+	{
+		pthread_t threads[MAX_THREADS];
+		size_t num_started = 0;
+
+		/* first worker runs in the calling thread; workers which failed to start are run there as well */
+		for (i = 1; i < num_threads; i++) {
+			if (pthread_create(&threads[i], NULL, worker_thread, &workers[i]) != 0)
+				break;
+			num_started = i;
+		}
+
+		run_worker(&workers[0]);
+		for (i = num_started + 1; i < num_threads; i++)
+			run_worker(&workers[i]);
+
+		for (i = 1; i <= num_started; i++)
+			pthread_join(threads[i], NULL);
+	}
+#else
+	for (i = 0; i < num_threads; i++)
+		run_worker(&workers[i]);
+#endif
+}
@@ -54,22 +54,24 @@ static int classify_keyword(const char* start, const char* end, int flags) {
 	return KEYWORD_UNKNOWN;
 }
 
+int get_alpha_component_metaorder(const char* start, const char* end, int flags, int is_letter_suffix) {
+	switch (classify_keyword(start, end, flags)) {
+	case KEYWORD_PRE_RELEASE:
+		return METAORDER_PRE_RELEASE;
+	case KEYWORD_POST_RELEASE:
+		return METAORDER_POST_RELEASE;
+	default:
+		if (is_letter_suffix)
+			return METAORDER_LETTER_SUFFIX;
+		return (flags & VERSIONFLAG_ANY_IS_PATCH) ? METAORDER_POST_RELEASE : METAORDER_PRE_RELEASE;
+	}
+}
+
 static void parse_token_to_component(const char** str, component_t* component, int flags) {
 	if (my_isalpha(**str)) {
 		component->start = *str;
 		component->end = *str = skip_alpha(*str);
-
-		switch (classify_keyword(component->start, component->end, flags)) {
-		case KEYWORD_UNKNOWN:
-			component->metaorder = (flags & VERSIONFLAG_ANY_IS_PATCH) ? METAORDER_POST_RELEASE : METAORDER_PRE_RELEASE;
-			break;
-		case KEYWORD_PRE_RELEASE:
-			component->metaorder = METAORDER_PRE_RELEASE;
-			break;
-		case KEYWORD_POST_RELEASE:
-			component->metaorder = METAORDER_POST_RELEASE;
-			break;
-		}
+		component->metaorder = get_alpha_component_metaorder(component->start, component->end, flags, 0);
 	} else {
 		component->start = *str = skip_zeroes(*str);
 		component->end = *str = skip_number(*str);
@@ -119,18 +121,7 @@ size_t get_next_version_component(const char** str, component_t* component, int
 		component->end = skip_alpha(*str);
 
 		if (!my_isnumber(*component->end)) {
-			switch (classify_keyword(component->start, component->end, flags)) {
-			case KEYWORD_UNKNOWN:
-				component->metaorder = METAORDER_LETTER_SUFFIX;
-				break;
-			case KEYWORD_PRE_RELEASE:
-				component->metaorder = METAORDER_PRE_RELEASE;
-				break;
-			case KEYWORD_POST_RELEASE:
-				component->metaorder = METAORDER_POST_RELEASE;
-				break;
-			}
-
+			component->metaorder = get_alpha_component_metaorder(component->start, component->end, flags, 1);
 			*str = component->end;
 			return 2;
 		}
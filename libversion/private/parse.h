@@ -27,6 +27,7 @@
 
 #include <libversion/private/component.h>
 
+int get_alpha_component_metaorder(const char* start, const char* end, int flags, int is_letter_suffix);
 size_t get_next_version_component(const char** str, component_t* component, int flags);
 
 #endif /* LIBVERSION_PRIVATE_PARSE_H */
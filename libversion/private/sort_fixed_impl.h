@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Fixed width key sort, instantiated by sort_fixed.c for each number
+ * of leading key words held in entries. Including file defines
+ * FIXED_WORDS and FIXED_NAME(name), which makes names unique for the
+ * instantiation. With the number of words known at compile time,
+ * word loops are unrolled, and entries for short keys are smaller.
+ * Intentionally has no include guard.
+ */
+
+#define FIXED_WIDTH (FIXED_WORDS * 8)
+
+typedef struct {
+	uint64_t words[FIXED_WORDS];
+	size_t index;
+} FIXED_NAME(entry_t);
+
+static inline int FIXED_NAME(fixed_less)(const FIXED_NAME(entry_t)* a, const FIXED_NAME(entry_t)* b) {
+	int less = 0, greater = 0;
+	size_t i;
+
+	for (i = 0; i < FIXED_WORDS; i++) {
+		less |= !greater & (a->words[i] < b->words[i]);
+		greater |= !less & (a->words[i] > b->words[i]);
+	}
+
+	return less | (!greater & (a->index < b->index));
+}
+
+static inline void FIXED_NAME(compare_exchange)(FIXED_NAME(entry_t)* a, FIXED_NAME(entry_t)* b) {
+	uint64_t mask = -(uint64_t)FIXED_NAME(fixed_less)(b, a);
+	uint64_t diff;
+	size_t i;
+
+	for (i = 0; i < FIXED_WORDS; i++) {
+		diff = (a->words[i] ^ b->words[i]) & mask;
+		a->words[i] ^= diff;
+		b->words[i] ^= diff;
+	}
+
+	diff = ((uint64_t)a->index ^ (uint64_t)b->index) & mask;
+	a->index ^= (size_t)diff;
+	b->index ^= (size_t)diff;
+}
+
+/* Batcher's odd-even merge sort network for 8 elements, 19 comparators */
+static void FIXED_NAME(sort_network)(FIXED_NAME(entry_t)* e) {
+	static const unsigned char network[][2] = {
+		{0, 1}, {2, 3}, {4, 5}, {6, 7},
+		{0, 2}, {1, 3}, {4, 6}, {5, 7},
+		{1, 2}, {5, 6}, {0, 4}, {1, 5},
+		{2, 6}, {3, 7}, {2, 4}, {3, 5},
+		{1, 2}, {3, 4}, {5, 6},
+	};
+	size_t i;
+
+	for (i = 0; i < sizeof(network) / sizeof(network[0]); i++)
+		FIXED_NAME(compare_exchange)(&e[network[i][0]], &e[network[i][1]]);
+}
+
+static void FIXED_NAME(insertion_sort)(FIXED_NAME(entry_t)* entries, size_t count) {
+	size_t i, j;
+	FIXED_NAME(entry_t) entry;
+
+	for (i = 1; i < count; i++) {
+		entry = entries[i];
+		for (j = i; j > 0 && FIXED_NAME(fixed_less)(&entry, &entries[j - 1]); j--)
+			entries[j] = entries[j - 1];
+		entries[j] = entry;
+	}
+}
+
+static void FIXED_NAME(merge)(const FIXED_NAME(entry_t)* left, size_t left_count, const FIXED_NAME(entry_t)* right, size_t right_count, FIXED_NAME(entry_t)* out) {
+	const FIXED_NAME(entry_t)* left_end = left + left_count;
+	const FIXED_NAME(entry_t)* right_end = right + right_count;
+	int take_right;
+
+	while (left != left_end && right != right_end) {
+		take_right = FIXED_NAME(fixed_less)(right, left);
+		*out++ = take_right ? *right : *left;
+		right += take_right;
+		left += !take_right;
+	}
+
+	while (left != left_end)
+		*out++ = *left++;
+	while (right != right_end)
+		*out++ = *right++;
+}
+
+/* bottom-up merge sort of network sorted runs; result is placed into entries */
+static void FIXED_NAME(merge_sort)(FIXED_NAME(entry_t)* entries, FIXED_NAME(entry_t)* tmp, size_t count) {
+	FIXED_NAME(entry_t)* from = entries;
+	FIXED_NAME(entry_t)* to = tmp;
+	FIXED_NAME(entry_t)* swap;
+	size_t run, start, middle, end;
+
+	for (start = 0; start + NETWORK_SIZE <= count; start += NETWORK_SIZE)
+		FIXED_NAME(sort_network)(entries + start);
+	FIXED_NAME(insertion_sort)(entries + start, count - start);
+
+	for (run = NETWORK_SIZE; run < count; run *= 2) {
+		for (start = 0; start < count; start += 2 * run) {
+			middle = start + run < count ? start + run : count;
+			end = start + 2 * run < count ? start + 2 * run : count;
+			FIXED_NAME(merge)(from + start, middle - start, from + middle, end - middle, to + start);
+		}
+		swap = from;
+		from = to;
+		to = swap;
+	}
+
+	if (from != entries)
+		memcpy(entries, from, count * sizeof(FIXED_NAME(entry_t)));
+}
+
+/* orders entries with equal leading words by the rest of the key, then by tiebreak */
+static int FIXED_NAME(run_less)(const tiebreak_context_t* context, const FIXED_NAME(entry_t)* a, const FIXED_NAME(entry_t)* b) {
+	const unsigned char* ea = context->elements + a->index * context->stride;
+	const unsigned char* eb = context->elements + b->index * context->stride;
+	int res = 0;
+
+	if (context->width > FIXED_WIDTH)
+		res = memcmp(ea + FIXED_WIDTH, eb + FIXED_WIDTH, context->width - FIXED_WIDTH);
+
+	if (res == 0 && context->tiebreak != NULL && VERSION_KEY_FIXED_OVERFLOW(ea, context->width) && VERSION_KEY_FIXED_OVERFLOW(eb, context->width))
+		res = context->tiebreak(ea, eb, context->userdata);
+
+	if (res == 0)
+		return a->index < b->index;
+
+	return res < 0;
+}
+
+/* stable top-down merge sort of a run of entries with equal leading words */
+static void FIXED_NAME(sort_run)(const tiebreak_context_t* context, FIXED_NAME(entry_t)* entries, FIXED_NAME(entry_t)* tmp, size_t count) {
+	size_t middle = count / 2, left, right, out;
+
+	if (count < 2)
+		return;
+
+	FIXED_NAME(sort_run)(context, entries, tmp, middle);
+	FIXED_NAME(sort_run)(context, entries + middle, tmp, count - middle);
+
+	for (left = 0, right = middle, out = 0; left < middle && right < count; out++)
+		tmp[out] = FIXED_NAME(run_less)(context, &entries[right], &entries[left]) ? entries[right++] : entries[left++];
+	while (left < middle)
+		tmp[out++] = entries[left++];
+	while (right < count)
+		tmp[out++] = entries[right++];
+
+	memcpy(entries, tmp, count * sizeof(FIXED_NAME(entry_t)));
+}
+
+static int FIXED_NAME(equal_words)(const FIXED_NAME(entry_t)* a, const FIXED_NAME(entry_t)* b) {
+	size_t i;
+
+	for (i = 0; i < FIXED_WORDS; i++)
+		if (a->words[i] != b->words[i])
+			return 0;
+
+	return 1;
+}
+
+/* sorts elements in place, returns 0 if memory allocation has failed */
+static int FIXED_NAME(sort_fixed)(const tiebreak_context_t* context, void* elements, size_t count) {
+	FIXED_NAME(entry_t)* entries;
+	FIXED_NAME(entry_t)* tmp;
+	unsigned char* sorted;
+	const unsigned char* element;
+	size_t stride = context->stride, i, j, run_start;
+
+	entries = malloc(count * sizeof(FIXED_NAME(entry_t)));
+	tmp = malloc(count * sizeof(FIXED_NAME(entry_t)));
+	sorted = malloc(count * stride);
+
+	if (entries == NULL || tmp == NULL || sorted == NULL) {
+		free(entries);
+		free(tmp);
+		free(sorted);
+		return 0;
+	}
+
+	/* keys shorter than leading words are loaded zero padded */
+	for (i = 0; i < count; i++) {
+		element = (const unsigned char*)elements + i * stride;
+		memset(entries[i].words, 0, sizeof(entries[i].words));
+		for (j = 0; j < context->width && j < FIXED_WIDTH; j++)
+			entries[i].words[j / 8] |= (uint64_t)element[j] << (56 - 8 * (j % 8));
+		entries[i].index = i;
+	}
+
+	FIXED_NAME(merge_sort)(entries, tmp, count);
+
+	/* leading words only fully order keys which fit into them and did not overflow */
+	if (context->width > FIXED_WIDTH || context->tiebreak != NULL) {
+		for (run_start = 0, i = 1; i <= count; i++) {
+			if (i == count || !FIXED_NAME(equal_words)(&entries[run_start], &entries[i])) {
+				FIXED_NAME(sort_run)(context, entries + run_start, tmp, i - run_start);
+				run_start = i;
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++)
+		memcpy(sorted + i * stride, (const unsigned char*)elements + entries[i].index * stride, stride);
+	memcpy(elements, sorted, count * stride);
+
+	free(entries);
+	free(tmp);
+	free(sorted);
+
+	return 1;
+}
+
+#undef FIXED_WIDTH
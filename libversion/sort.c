@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/sort.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/key.h>
+
+#define ABBREV_LENGTH 8
+#define INSERTION_SORT_THRESHOLD 16
+#define RADIX_SORT_THRESHOLD 64
+#define MIN_SAMPLED_COUNT 1024
+#define SAMPLE_SIZE 1024
+#define MIN_RUN_LENGTH 32
+#define MIN_AVERAGE_RUN_LENGTH 64
+
+/*
+ * All engines sort an array of entries, each holding index of an item
+ * and its abbreviated key, e.g. first 8 bytes of a key starting at
+ * a given depth, packed into a big endian integer, so most comparisons
+ * are resolved without touching the item.
+ */
+typedef struct {
+	uint64_t abbrev;
+	size_t index;
+} entry_t;
+
+static inline uint64_t load_abbrev(const version_sort_item_t* item, size_t depth) {
+	uint64_t abbrev = 0;
+	size_t i;
+
+	for (i = 0; i < ABBREV_LENGTH; i++) {
+		abbrev <<= 8;
+		if (depth + i < item->key_length)
+			abbrev |= item->key[depth + i];
+	}
+
+	return abbrev;
+}
+
+/* compares items which are known to share first depth bytes of keys */
+static inline int compare_items_from(const version_sort_item_t* a, const version_sort_item_t* b, size_t depth) {
+	int res = key_compare(a->key + depth, a->key_length - depth, b->key + depth, b->key_length - depth);
+
+	if (res == 0 && a->text != NULL && b->text != NULL)
+		res = key_compare((const unsigned char*)a->text, a->text_length, (const unsigned char*)b->text, b->text_length);
+
+	return res;
+}
+
+static int compare_items(const void* a, const void* b) {
+	return compare_items_from((const version_sort_item_t*)a, (const version_sort_item_t*)b, 0);
+}
+
+static inline int entry_less(const version_sort_item_t* items, const entry_t* a, const entry_t* b, size_t depth) {
+	if (a->abbrev != b->abbrev)
+		return a->abbrev < b->abbrev;
+	return compare_items_from(&items[a->index], &items[b->index], depth) < 0;
+}
+
+static void insertion_sort(const version_sort_item_t* items, entry_t* entries, size_t count, size_t depth) {
+	size_t i, j;
+	entry_t entry;
+
+	for (i = 1; i < count; i++) {
+		entry = entries[i];
+		for (j = i; j > 0 && entry_less(items, &entry, &entries[j - 1], depth); j--)
+			entries[j] = entries[j - 1];
+		entries[j] = entry;
+	}
+}
+
+static void merge(const version_sort_item_t* items, const entry_t* left, size_t left_count, const entry_t* right, size_t right_count, entry_t* out, size_t depth) {
+	const entry_t* left_end = left + left_count;
+	const entry_t* right_end = right + right_count;
+
+	/* taking left entry on ties keeps the sort stable */
+	while (left != left_end && right != right_end)
+		*out++ = entry_less(items, right, left, depth) ? *right++ : *left++;
+
+	while (left != left_end)
+		*out++ = *left++;
+	while (right != right_end)
+		*out++ = *right++;
+}
+
+/* stable bottom-up merge sort; tmp must hold count entries */
+static void merge_sort(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count, size_t depth) {
+	entry_t* from = entries;
+	entry_t* to = tmp;
+	entry_t* swap;
+	size_t width, start, middle, end;
+
+	for (start = 0; start < count; start += INSERTION_SORT_THRESHOLD)
+		insertion_sort(items, entries + start, count - start < INSERTION_SORT_THRESHOLD ? count - start : INSERTION_SORT_THRESHOLD, depth);
+
+	for (width = INSERTION_SORT_THRESHOLD; width < count; width *= 2) {
+		for (start = 0; start < count; start += 2 * width) {
+			middle = start + width < count ? start + width : count;
+			end = start + 2 * width < count ? start + 2 * width : count;
+			merge(items, from + start, middle - start, from + middle, end - middle, to + start, depth);
+		}
+		swap = from;
+		from = to;
+		to = swap;
+	}
+
+	if (from != entries)
+		memcpy(entries, from, count * sizeof(entry_t));
+}
+
+static void abbreviate(const version_sort_item_t* items, entry_t* entries, size_t count, size_t depth) {
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		entries[i].abbrev = load_abbrev(&items[entries[i].index], depth);
+}
+
+static void sort_comparison(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count) {
+	merge_sort(items, entries, tmp, count, 0);
+}
+
+static void sort_radix(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count, size_t depth) {
+	size_t counts[257], offsets[257];
+	size_t i, bucket, largest, item_bucket;
+	const version_sort_item_t* item;
+
+	for (;;) {
+		if (count < RADIX_SORT_THRESHOLD) {
+			abbreviate(items, entries, count, depth);
+			merge_sort(items, entries, tmp, count, depth);
+			return;
+		}
+
+		/* bucket 0 holds exhausted keys, which are all equal as keys are prefix free */
+		memset(counts, 0, sizeof(counts));
+		for (i = 0; i < count; i++) {
+			item = &items[entries[i].index];
+			counts[item->key_length > depth ? item->key[depth] + 1 : 0]++;
+		}
+
+		offsets[0] = 0;
+		for (bucket = 1; bucket < 257; bucket++)
+			offsets[bucket] = offsets[bucket - 1] + counts[bucket - 1];
+
+		for (i = 0; i < count; i++) {
+			item = &items[entries[i].index];
+			item_bucket = item->key_length > depth ? item->key[depth] + 1 : 0;
+			tmp[offsets[item_bucket]++] = entries[i];
+		}
+		memcpy(entries, tmp, count * sizeof(entry_t));
+
+		/* only text is left to compare for exhausted keys */
+		if (counts[0] > 1) {
+			abbreviate(items, entries, counts[0], depth);
+			merge_sort(items, entries, tmp, counts[0], depth);
+		}
+
+		/* recurse into all buckets but the largest, which is processed in place to limit recursion depth */
+		largest = 1;
+		for (bucket = 2; bucket < 257; bucket++)
+			if (counts[bucket] > counts[largest])
+				largest = bucket;
+
+		for (bucket = 1, i = counts[0]; bucket < 257; i += counts[bucket++])
+			if (bucket != largest && counts[bucket] > 1)
+				sort_radix(items, entries + i, tmp, counts[bucket], depth + 1);
+
+		for (bucket = 1, i = counts[0]; bucket < largest; bucket++)
+			i += counts[bucket];
+
+		entries += i;
+		count = counts[largest];
+		depth++;
+	}
+}
+
+static void sort_packed(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count) {
+	size_t counts[256], offsets[256];
+	size_t i, start, end;
+	int shift;
+	entry_t* from = entries;
+	entry_t* to = tmp;
+	entry_t* swap;
+
+	/* stable LSD radix sort by 8 bit digits, skipping digits which are the same for all entries */
+	for (shift = 0; shift < 64; shift += 8) {
+		memset(counts, 0, sizeof(counts));
+		for (i = 0; i < count; i++)
+			counts[(from[i].abbrev >> shift) & 0xff]++;
+
+		if (counts[(from[0].abbrev >> shift) & 0xff] == count)
+			continue;
+
+		offsets[0] = 0;
+		for (i = 1; i < 256; i++)
+			offsets[i] = offsets[i - 1] + counts[i - 1];
+
+		for (i = 0; i < count; i++)
+			to[offsets[(from[i].abbrev >> shift) & 0xff]++] = from[i];
+
+		swap = from;
+		from = to;
+		to = swap;
+	}
+
+	if (from != entries)
+		memcpy(entries, from, count * sizeof(entry_t));
+
+	/* entries with equal packed keys are either longer keys, or equal keys with different text */
+	for (start = 0; start < count; start = end) {
+		for (end = start + 1; end < count && entries[end].abbrev == entries[start].abbrev; end++)
+			;
+		if (end - start > 1)
+			merge_sort(items, entries + start, tmp, end - start, 0);
+	}
+}
+
+static void reverse(entry_t* entries, size_t count) {
+	entry_t* last = entries + count - 1;
+	entry_t entry;
+
+	for (; entries < last; entries++, last--) {
+		entry = *entries;
+		*entries = *last;
+		*last = entry;
+	}
+}
+
+/*
+ * finds presorted run at the start of entries, reversing it if it's
+ * descending, and extends short runs with insertion sort
+ */
+static size_t find_run(const version_sort_item_t* items, entry_t* entries, size_t count) {
+	size_t end;
+
+	if (count < 2)
+		return count;
+
+	/* only strictly descending runs may be reversed without breaking stability */
+	if (entry_less(items, &entries[1], &entries[0], 0)) {
+		for (end = 2; end < count && entry_less(items, &entries[end], &entries[end - 1], 0); end++)
+			;
+		reverse(entries, end);
+	} else {
+		for (end = 2; end < count && !entry_less(items, &entries[end], &entries[end - 1], 0); end++)
+			;
+	}
+
+	if (end < MIN_RUN_LENGTH && end < count) {
+		end = count < MIN_RUN_LENGTH ? count : MIN_RUN_LENGTH;
+		insertion_sort(items, entries, end, 0);
+	}
+
+	return end;
+}
+
+/*
+ * powersort node power of the boundary between adjacent runs
+ * [begin, middle) and [middle, end): the first bit in which binary
+ * fractions of the run midpoints relative to count differ
+ */
+static int node_power(size_t begin, size_t middle, size_t end, size_t count) {
+	uint64_t left = (uint64_t)begin + middle, right = (uint64_t)middle + end, scale = 2 * (uint64_t)count;
+	int left_bit, right_bit, power = 0;
+
+	do {
+		power++;
+		left <<= 1;
+		right <<= 1;
+		left_bit = left >= scale;
+		right_bit = right >= scale;
+		if (left_bit)
+			left -= scale;
+		if (right_bit)
+			right -= scale;
+	} while (left_bit == right_bit);
+
+	return power;
+}
+
+static void merge_runs(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t begin, size_t middle, size_t end) {
+	/* concatenated runs which are already in order are common in presorted input */
+	if (!entry_less(items, &entries[middle], &entries[middle - 1], 0))
+		return;
+
+	merge(items, entries + begin, middle - begin, entries + middle, end - middle, tmp, 0);
+	memcpy(entries + begin, tmp, (end - begin) * sizeof(entry_t));
+}
+
+static void sort_natural(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count) {
+	/* node powers on the stack strictly increase and never exceed 64 */
+	struct {
+		size_t begin;
+		int power;
+	} stack[72];
+	size_t top = 0, begin = 0, end, next_end;
+	int power;
+
+	end = find_run(items, entries, count);
+
+	while (end < count) {
+		next_end = end + find_run(items, entries + end, count - end);
+		power = node_power(begin, end, next_end, count);
+
+		while (top > 0 && stack[top - 1].power > power) {
+			top--;
+			merge_runs(items, entries, tmp, stack[top].begin, begin, end);
+			begin = stack[top].begin;
+		}
+
+		stack[top].begin = begin;
+		stack[top].power = power;
+		top++;
+
+		begin = end;
+		end = next_end;
+	}
+
+	while (top > 0) {
+		top--;
+		merge_runs(items, entries, tmp, stack[top].begin, begin, end);
+		begin = stack[top].begin;
+	}
+}
+
+/*
+ * linear pass counting runs the way find_run() does, which stops as
+ * soon as runs become too short on average for merging them to pay off
+ */
+static int is_presorted(const version_sort_item_t* items, size_t count) {
+	size_t i, run_start = 0, num_runs = 1, max_runs = count / MIN_AVERAGE_RUN_LENGTH;
+	int res, descending = 0;
+
+	for (i = 1; i < count; i++) {
+		res = compare_items(&items[i - 1], &items[i]);
+		if (run_start == i - 1) {
+			descending = res > 0;
+		} else if (descending ? res <= 0 : res > 0) {
+			run_start = i;
+			if (++num_runs > max_runs)
+				return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int compare_abbrevs(const void* a, const void* b) {
+	uint64_t ua = *(const uint64_t*)a, ub = *(const uint64_t*)b;
+	return ua < ub ? -1 : ua > ub ? 1 : 0;
+}
+
+int version_sort_choose_engine(const version_sort_item_t* items, size_t count) {
+	uint64_t sample[SAMPLE_SIZE];
+	size_t sample_size, step, i, num_packable = 0, num_distinct = 1;
+
+	if (count < MIN_SAMPLED_COUNT)
+		return VERSIONSORT_COMPARISON;
+
+	/* concatenations of sorted lists and nearly sorted input are merged in close to linear time */
+	if (is_presorted(items, count))
+		return VERSIONSORT_NATURAL;
+
+	sample_size = count < SAMPLE_SIZE ? count : SAMPLE_SIZE;
+	step = count / sample_size;
+
+	for (i = 0; i < sample_size; i++) {
+		sample[i] = load_abbrev(&items[i * step], 0);
+		if (items[i * step].key_length <= ABBREV_LENGTH)
+			num_packable++;
+	}
+
+	/* short keys (e.g. versions with few small numeric components) are fully ordered by integer radix sort */
+	if (num_packable * 20 >= sample_size * 19)
+		return VERSIONSORT_PACKED;
+
+	/* if abbreviated keys are mostly distinct, comparison sort rarely needs to look at full keys */
+	qsort(sample, sample_size, sizeof(uint64_t), compare_abbrevs);
+	for (i = 1; i < sample_size; i++)
+		if (sample[i] != sample[i - 1])
+			num_distinct++;
+
+	if (num_distinct * 10 >= sample_size * 9)
+		return VERSIONSORT_COMPARISON;
+
+	/* otherwise keys share long prefixes, which byte radix sort skips cheaply */
+	return VERSIONSORT_RADIX;
+}
+
+/* fills entries with indexes of items in sorted order; tmp must hold count entries */
+static void sort_entries(const version_sort_item_t* items, entry_t* entries, entry_t* tmp, size_t count, int engine) {
+	size_t i;
+
+	if (engine == VERSIONSORT_AUTO)
+		engine = version_sort_choose_engine(items, count);
+
+	for (i = 0; i < count; i++) {
+		entries[i].abbrev = load_abbrev(&items[i], 0);
+		entries[i].index = i;
+	}
+
+	switch (engine) {
+	case VERSIONSORT_RADIX:
+		sort_radix(items, entries, tmp, count, 0);
+		break;
+	case VERSIONSORT_PACKED:
+		sort_packed(items, entries, tmp, count);
+		break;
+	case VERSIONSORT_NATURAL:
+		sort_natural(items, entries, tmp, count);
+		break;
+	default:
+		sort_comparison(items, entries, tmp, count);
+		break;
+	}
+}
+
+void version_sort_items(version_sort_item_t* items, size_t count, int engine) {
+	entry_t* entries;
+	entry_t* tmp;
+	version_sort_item_t* sorted;
+	size_t i;
+
+	if (count < 2)
+		return;
+
+	entries = malloc(count * sizeof(entry_t));
+	tmp = malloc(count * sizeof(entry_t));
+	sorted = malloc(count * sizeof(version_sort_item_t));
+
+	if (entries == NULL || tmp == NULL || sorted == NULL) {
+		/* fallback which does not need additional memory */
+		free(entries);
+		free(tmp);
+		free(sorted);
+		qsort(items, count, sizeof(version_sort_item_t), compare_items);
+		return;
+	}
+
+	sort_entries(items, entries, tmp, count, engine);
+
+	for (i = 0; i < count; i++)
+		sorted[i] = items[entries[i].index];
+	memcpy(items, sorted, count * sizeof(version_sort_item_t));
+
+	free(entries);
+	free(tmp);
+	free(sorted);
+}
+
+int version_sort_indexes(const version_sort_item_t* items, size_t count, int engine, size_t* indexes) {
+	entry_t* entries;
+	entry_t* tmp;
+	size_t i;
+
+	if (count < 2) {
+		for (i = 0; i < count; i++)
+			indexes[i] = i;
+		return 1;
+	}
+
+	entries = malloc(count * sizeof(entry_t));
+	tmp = malloc(count * sizeof(entry_t));
+
+	if (entries == NULL || tmp == NULL) {
+		free(entries);
+		free(tmp);
+		return 0;
+	}
+
+	sort_entries(items, entries, tmp, count, engine);
+
+	for (i = 0; i < count; i++)
+		indexes[i] = entries[i].index;
+
+	free(entries);
+	free(tmp);
+
+	return 1;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_SORT_H
+#define LIBVERSION_SORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include <libversion/version.h>
+
+enum {
+	VERSIONSORT_AUTO,
+	VERSIONSORT_COMPARISON,   /* merge sort with abbreviated keys */
+	VERSIONSORT_RADIX,        /* MSD byte radix sort on keys */
+	VERSIONSORT_PACKED,       /* LSD integer radix sort on keys packed into 64 bits */
+	VERSIONSORT_NATURAL,      /* merge of presorted ascending and descending runs */
+};
+
+typedef struct {
+	const unsigned char* key;
+	size_t key_length;
+	const char* text;         /* optional, breaks ties between equal keys bytewise */
+	size_t text_length;
+} version_sort_item_t;
+
+/* compares two elements with equal overflowed fixed width keys */
+typedef int (*version_sort_tiebreak_t)(const void* a, const void* b, void* userdata);
+
+extern LIBVERSION_EXPORT int version_sort_choose_engine(const version_sort_item_t* items, size_t count);
+extern LIBVERSION_EXPORT void version_sort_items(version_sort_item_t* items, size_t count, int engine);
+extern LIBVERSION_EXPORT int version_sort_indexes(const version_sort_item_t* items, size_t count, int engine, size_t* indexes);
+
+extern LIBVERSION_EXPORT int version_sort_fixed(void* elements, size_t count, size_t stride, size_t width, version_sort_tiebreak_t tiebreak, void* userdata);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBVERSION_SORT_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/sort.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NETWORK_SIZE 8
+
+/*
+ * Fixed width keys are sorted as entries holding the key (up to its
+ * first 16 or 32 bytes, depending on width) as big endian 64 bit
+ * words, along with element index which breaks ties, making the
+ * order total, and the sort stable. Comparisons, compare-exchanges
+ * in the sorting network used for initial runs and the merge loop
+ * are written without data dependent branches, so they are compiled
+ * into conditional moves instead of hard to predict jumps.
+ */
+typedef struct {
+	const unsigned char* elements;
+	size_t stride;
+	size_t width;
+	version_sort_tiebreak_t tiebreak;
+	void* userdata;
+} tiebreak_context_t;
+
+/* 16 byte keys, 24 byte entries */
+#define FIXED_WORDS 2
+#define FIXED_NAME(name) name##_2
+#include <libversion/private/sort_fixed_impl.h>
+#undef FIXED_WORDS
+#undef FIXED_NAME
+
+/* 32 byte keys, and leading 32 bytes of longer keys, 40 byte entries */
+#define FIXED_WORDS 4
+#define FIXED_NAME(name) name##_4
+#include <libversion/private/sort_fixed_impl.h>
+#undef FIXED_WORDS
+#undef FIXED_NAME
+
+int version_sort_fixed(void* elements, size_t count, size_t stride, size_t width, version_sort_tiebreak_t tiebreak, void* userdata) {
+	tiebreak_context_t context;
+
+	if (count < 2 || width == 0)
+		return 1;
+
+	context.elements = (const unsigned char*)elements;
+	context.stride = stride;
+	context.width = width;
+	context.tiebreak = tiebreak;
+	context.userdata = userdata;
+
+	if (width <= 16)
+		return sort_fixed_2(&context, elements, count);
+
+	return sort_fixed_4(&context, elements, count);
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <libversion/version.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <libversion/private/component.h>
+#include <libversion/private/key.h>
+#include <libversion/private/parse.h>
+#include <libversion/private/string.h>
+
+enum {
+	STATE_SEPARATOR,
+	STATE_NUMBER,
+	STATE_ALPHA,
+};
+
+/* unlike NUL terminated strings, NUL is just another separator here */
+static inline int is_stream_separator(char c) {
+	return !my_isnumber(c) && !my_isalpha(c);
+}
+
+static int append_token(version_stream_t* stream, const char* data, size_t length) {
+	size_t capacity = stream->token_capacity;
+	char* token;
+
+	if (stream->token_length + length > capacity) {
+		while (stream->token_length + length > capacity)
+			capacity *= 2;
+
+		token = malloc(capacity);
+		if (token == NULL) {
+			stream->failed = 1;
+			return 0;
+		}
+
+		memcpy(token, stream->token, stream->token_length);
+		if (stream->token != stream->token_storage)
+			free(stream->token);
+
+		stream->token = token;
+		stream->token_capacity = capacity;
+	}
+
+	memcpy(stream->token + stream->token_length, data, length);
+	stream->token_length += length;
+	return 1;
+}
+
+/* returns text of a token which ends at the given point, reassembling it if it spans multiple chunks */
+static int take_token(version_stream_t* stream, const char* start, const char* end, const char** text, size_t* length) {
+	if (stream->token_length == 0) {
+		*text = start;
+		*length = end - start;
+		return 1;
+	}
+
+	if (!append_token(stream, start, end - start))
+		return 0;
+
+	*text = stream->token;
+	*length = stream->token_length;
+	stream->token_length = 0;
+	return 1;
+}
+
+static void emit_component(version_stream_t* stream, int kind, int metaorder, const char* text, size_t length, size_t offset) {
+	version_component_t component;
+
+	key_encoder_push(&stream->key, metaorder, text, length);
+
+	if (stream->callback != NULL) {
+		component.kind = kind;
+		component.metaorder = metaorder;
+		component.offset = offset;
+		component.length = length;
+		stream->callback(&component, text, stream->userdata);
+	}
+}
+
+static void emit_number(version_stream_t* stream, const char* text, size_t length) {
+	size_t offset = stream->token_offset;
+
+	while (length > 0 && *text == '0') {
+		text++;
+		length--;
+		offset++;
+	}
+
+	emit_component(stream, VERSIONCOMPONENT_NUMERIC, length == 0 ? METAORDER_ZERO : METAORDER_NONZERO, text, length, offset);
+}
+
+static void emit_alpha(version_stream_t* stream, const char* text, size_t length, int followed_by_number) {
+	int metaorder = get_alpha_component_metaorder(text, text + length, stream->flags, stream->alpha_after_number && !followed_by_number);
+
+	emit_component(stream, VERSIONCOMPONENT_ALPHABETIC, metaorder, text, length, stream->token_offset);
+}
+
+void version_stream_init(version_stream_t* stream, int flags, unsigned char* key, size_t capacity) {
+	stream->flags = flags;
+	stream->state = STATE_SEPARATOR;
+	stream->alpha_after_number = 0;
+	stream->failed = 0;
+	stream->offset = 0;
+	stream->token_offset = 0;
+	stream->token = stream->token_storage;
+	stream->token_length = 0;
+	stream->token_capacity = sizeof(stream->token_storage);
+	stream->callback = NULL;
+	stream->userdata = NULL;
+
+	key_encoder_init(&stream->key, flags, key, capacity);
+}
+
+void version_stream_set_callback(version_stream_t* stream, version_stream_callback_t callback, void* userdata) {
+	stream->callback = callback;
+	stream->userdata = userdata;
+}
+
+void version_stream_feed(version_stream_t* stream, const char* data, size_t length) {
+	const char* cur = data;
+	const char* end = data + length;
+	const char* token_start = data; /* part of the current token which lies in this chunk */
+	const char* text;
+	size_t text_length;
+
+	if (stream->failed)
+		return;
+
+	while (cur != end) {
+		if (stream->state == STATE_SEPARATOR) {
+			while (cur != end && is_stream_separator(*cur))
+				++cur;
+			if (cur == end)
+				break;
+
+			stream->state = my_isnumber(*cur) ? STATE_NUMBER : STATE_ALPHA;
+			stream->alpha_after_number = 0;
+			stream->token_offset = stream->offset + (cur - data);
+			token_start = cur;
+		}
+
+		if (stream->state == STATE_NUMBER) {
+			while (cur != end && my_isnumber(*cur))
+				++cur;
+			if (cur == end)
+				break;
+
+			if (!take_token(stream, token_start, cur, &text, &text_length))
+				return;
+			emit_number(stream, text, text_length);
+
+			/* alphabetic component right after a number is a letter suffix candidate */
+			if (my_isalpha(*cur)) {
+				stream->state = STATE_ALPHA;
+				stream->alpha_after_number = 1;
+				stream->token_offset = stream->offset + (cur - data);
+				token_start = cur;
+			} else {
+				stream->state = STATE_SEPARATOR;
+			}
+		} else {
+			while (cur != end && my_isalpha(*cur))
+				++cur;
+			if (cur == end)
+				break;
+
+			if (!take_token(stream, token_start, cur, &text, &text_length))
+				return;
+			emit_alpha(stream, text, text_length, my_isnumber(*cur));
+
+			if (my_isnumber(*cur)) {
+				stream->state = STATE_NUMBER;
+				stream->token_offset = stream->offset + (cur - data);
+				token_start = cur;
+			} else {
+				stream->state = STATE_SEPARATOR;
+			}
+		}
+	}
+
+	/* token continues into the next chunk */
+	if (stream->state != STATE_SEPARATOR && !append_token(stream, token_start, cur - token_start))
+		return;
+
+	stream->offset += length;
+}
+
+size_t version_stream_finish(version_stream_t* stream) {
+	size_t length = 0;
+
+	if (!stream->failed) {
+		if (stream->state == STATE_NUMBER)
+			emit_number(stream, stream->token, stream->token_length);
+		else if (stream->state == STATE_ALPHA)
+			emit_alpha(stream, stream->token, stream->token_length, 0);
+
+		length = key_encoder_finish(&stream->key);
+	}
+
+	if (stream->token != stream->token_storage)
+		free(stream->token);
+
+	stream->token = stream->token_storage;
+	stream->token_length = 0;
+	stream->token_capacity = sizeof(stream->token_storage);
+	stream->state = STATE_SEPARATOR;
+
+	return length;
+}
@@ -27,6 +27,9 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <libversion/config.h>
 #include <libversion/export.h>
 
@@ -44,9 +47,90 @@ enum {
 	VERSIONFLAG_UPPER_BOUND = 0x8,
 };
 
+enum {
+	VERSIONMETAORDER_LOWER_BOUND,
+	VERSIONMETAORDER_PRE_RELEASE,
+	VERSIONMETAORDER_ZERO,
+	VERSIONMETAORDER_POST_RELEASE,
+	VERSIONMETAORDER_NONZERO,
+	VERSIONMETAORDER_LETTER_SUFFIX,
+	VERSIONMETAORDER_UPPER_BOUND,
+};
+
+enum {
+	VERSIONCOMPONENT_NUMERIC,
+	VERSIONCOMPONENT_ALPHABETIC,
+};
+
+typedef struct {
+	int kind;          /* VERSIONCOMPONENT_* */
+	int metaorder;     /* VERSIONMETAORDER_* */
+	size_t offset;     /* offset of component text in the version string */
+	size_t length;     /* length of component text (leading zeroes are not included) */
+} version_component_t;
+
+typedef struct {
+	/* private, do not access directly */
+	const char* start;
+	const char* cursor;
+	int flags;
+	int has_pending;
+	version_component_t pending;
+} version_iter_t;
+
+typedef struct {
+	/* private, do not access directly */
+	unsigned char* buffer;
+	size_t capacity;
+	size_t length;
+	size_t pending_zeroes;
+	int flags;
+} version_key_encoder_t;
+
+/* text is only valid during the callback */
+typedef void (*version_stream_callback_t)(const version_component_t* component, const char* text, void* userdata);
+
+typedef struct {
+	/* private, do not access directly */
+	int flags;
+	int state;
+	int alpha_after_number;
+	int failed;
+	size_t offset;
+	size_t token_offset;
+	char* token;
+	size_t token_length;
+	size_t token_capacity;
+	char token_storage[32];
+	version_stream_callback_t callback;
+	void* userdata;
+	version_key_encoder_t key;
+} version_stream_t;
+
+/* upper limit of key length for a version string of given length */
+#define VERSION_KEY_MAX_LENGTH(len) (2 * (len) + 1)
+
+/* whether fixed width key was truncated and needs full key comparison to break ties */
+#define VERSION_KEY_FIXED_OVERFLOW(key, width) ((key)[(width) - 1] != 0)
+
 extern LIBVERSION_EXPORT int version_compare2(const char* v1, const char* v2);
 extern LIBVERSION_EXPORT int version_compare4(const char* v1, const char* v2, int v1_flags, int v2_flags);
 
+extern LIBVERSION_EXPORT void version_iter_init(version_iter_t* iter, const char* v, int flags);
+extern LIBVERSION_EXPORT int version_iter_next(version_iter_t* iter, version_component_t* component);
+extern LIBVERSION_EXPORT size_t version_tokenize(const char* v, int flags, version_component_t* components, size_t capacity);
+
+extern LIBVERSION_EXPORT size_t version_key(const char* v, int flags, unsigned char* key, size_t capacity);
+extern LIBVERSION_EXPORT size_t version_key_fixed(const char* v, int flags, unsigned char* key, size_t width);
+extern LIBVERSION_EXPORT size_t version_key_multi(const char* v, const int* flags, size_t count, unsigned char* const* keys, size_t capacity, size_t* lengths);
+
+extern LIBVERSION_EXPORT uint64_t version_hash(const char* v, int flags);
+
+extern LIBVERSION_EXPORT void version_stream_init(version_stream_t* stream, int flags, unsigned char* key, size_t capacity);
+extern LIBVERSION_EXPORT void version_stream_set_callback(version_stream_t* stream, version_stream_callback_t callback, void* userdata);
+extern LIBVERSION_EXPORT void version_stream_feed(version_stream_t* stream, const char* data, size_t length);
+extern LIBVERSION_EXPORT size_t version_stream_finish(version_stream_t* stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/corpus.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_GENERATED 100000
+
+static const char* test_path = "corpus_test.tmp";
+
+static void generate_version(char* buffer, size_t size, unsigned* seed) {
+	static const char* suffixes[] = { "", "", "", "a", "alpha1", "rc2", "pl1", ".0", "-1" };
+
+	*seed = *seed * 1103515245 + 12345;
+	snprintf(buffer, size, "%u.%u.%u%s", (*seed >> 8) % 4, (*seed >> 12) % 12, (*seed >> 16) % 30, suffixes[(*seed >> 24) % 9]);
+}
+
+static int write_file(const char* data, size_t length) {
+	FILE* file = fopen(test_path, "wb");
+	if (file == NULL)
+		return 0;
+	fwrite(data, 1, length, file);
+	fclose(file);
+	return 1;
+}
+
+static int write_generated_file(void) {
+	FILE* file = fopen(test_path, "wb");
+	char buffer[64];
+	unsigned seed = 1;
+	size_t i;
+
+	if (file == NULL)
+		return 0;
+
+	for (i = 0; i < NUM_GENERATED; i++) {
+		generate_version(buffer, sizeof(buffer), &seed);
+		fprintf(file, "%s\n", buffer);
+	}
+	fclose(file);
+	return 1;
+}
+
+/* copies record into NUL terminated buffer to be able to use regular APIs */
+static const char* get_version(const version_corpus_t* corpus, size_t index, char* buffer, size_t size) {
+	size_t length;
+	const char* version = version_corpus_version(corpus, index, &length);
+
+	if (length >= size)
+		length = size - 1;
+	memcpy(buffer, version, length);
+	buffer[length] = '\0';
+	return buffer;
+}
+
+static int check(int condition, const char* message) {
+	if (condition) {
+		fprintf(stderr, "[ OK ] %s\n", message);
+		return 0;
+	} else {
+		fprintf(stderr, "[FAIL] %s\n", message);
+		return 1;
+	}
+}
+
+static int keys_match(const version_corpus_t* corpus) {
+	unsigned char expected[256];
+	char buffer[64];
+	const unsigned char* key;
+	size_t i, length, expected_length;
+
+	for (i = 0; i < version_corpus_size(corpus); i++) {
+		expected_length = version_key(get_version(corpus, i, buffer, sizeof(buffer)), 0, expected, sizeof(expected));
+		key = version_corpus_key(corpus, i, &length);
+		if (length != expected_length || memcmp(key, expected, length) != 0)
+			return 0;
+	}
+
+	return 1;
+}
+
+static int same_records(const version_corpus_t* c1, const version_corpus_t* c2) {
+	size_t i, l1, l2;
+	const char* v1;
+	const char* v2;
+
+	if (version_corpus_size(c1) != version_corpus_size(c2))
+		return 0;
+
+	for (i = 0; i < version_corpus_size(c1); i++) {
+		v1 = version_corpus_version(c1, i, &l1);
+		v2 = version_corpus_version(c2, i, &l2);
+		if (l1 != l2 || memcmp(v1, v2, l1) != 0)
+			return 0;
+	}
+
+	return 1;
+}
+
+static int is_sorted(const version_corpus_t* corpus) {
+	char prev[64], cur[64];
+	size_t i;
+
+	for (i = 1; i < version_corpus_size(corpus); i++)
+		if (version_compare2(get_version(corpus, i - 1, prev, sizeof(prev)), get_version(corpus, i, cur, sizeof(cur))) > 0)
+			return 0;
+
+	return 1;
+}
+
+/* checks that [lower bound, upper bound) range contains exactly versions belonging to the given release */
+static int range_matches(const version_corpus_t* corpus, const char* release) {
+	size_t lower = version_corpus_lower_bound(corpus, release, VERSIONFLAG_LOWER_BOUND);
+	size_t upper = version_corpus_upper_bound(corpus, release, VERSIONFLAG_UPPER_BOUND);
+	char buffer[64];
+	size_t i;
+	int inside;
+
+	for (i = 0; i < version_corpus_size(corpus); i++) {
+		get_version(corpus, i, buffer, sizeof(buffer));
+		inside = version_compare4(buffer, release, 0, VERSIONFLAG_LOWER_BOUND) > 0 && version_compare4(buffer, release, 0, VERSIONFLAG_UPPER_BOUND) < 0;
+		if (inside != (i >= lower && i < upper))
+			return 0;
+	}
+
+	return lower < upper;
+}
+
+static int equal_range_matches(const version_corpus_t* corpus, const char* v) {
+	size_t lower = version_corpus_lower_bound(corpus, v, 0);
+	size_t upper = version_corpus_upper_bound(corpus, v, 0);
+	char buffer[64];
+	size_t i;
+
+	for (i = 0; i < version_corpus_size(corpus); i++)
+		if ((version_compare2(get_version(corpus, i, buffer, sizeof(buffer)), v) == 0) != (i >= lower && i < upper))
+			return 0;
+
+	return lower < upper;
+}
+
+int main() {
+	version_corpus_t* single;
+	version_corpus_t* parallel;
+	version_corpus_t* corpus;
+	char buffer[64], long_version[2048];
+	int errors = 0;
+
+	fprintf(stderr, "Test group: parallel loading\n");
+	if (!write_generated_file()) {
+		fprintf(stderr, "[FAIL] cannot write %s\n", test_path);
+		return 1;
+	}
+
+	single = version_corpus_load_file(test_path, 0, 1);
+	parallel = version_corpus_load_file(test_path, 0, 4);
+
+	errors += check(single != NULL && parallel != NULL, "corpus loaded");
+	if (single == NULL || parallel == NULL)
+		return errors;
+
+	errors += check(version_corpus_size(single) == NUM_GENERATED, "all records loaded");
+	errors += check(same_records(single, parallel), "single and multi threaded loads produce same records");
+	errors += check(keys_match(parallel), "keys match version_key()");
+
+	fprintf(stderr, "\nTest group: batch operations\n");
+	version_corpus_sort(parallel);
+	errors += check(is_sorted(parallel), "sorted");
+	errors += check(keys_match(parallel), "keys match version_key() after sort");
+	errors += check(range_matches(parallel, "1.2"), "release range for 1.2");
+	errors += check(range_matches(parallel, "2"), "release range for 2");
+	errors += check(equal_range_matches(parallel, "1.2.3"), "equal range for 1.2.3");
+	errors += check(version_corpus_lower_bound(parallel, "999", 0) == version_corpus_size(parallel), "lower bound past the end");
+	errors += check(version_corpus_lower_bound(parallel, "0", VERSIONFLAG_LOWER_BOUND) == 0, "lower bound at the start");
+	memset(long_version, '1', sizeof(long_version) - 1);
+	long_version[sizeof(long_version) - 1] = '\0';
+	errors += check(version_corpus_lower_bound(parallel, long_version, 0) == version_corpus_size(parallel), "lower bound with a key not fitting on stack");
+
+	version_corpus_free(single);
+	version_corpus_free(parallel);
+
+	fprintf(stderr, "\nTest group: record delimiting\n");
+	write_file("1.0\r\n\n2.0", 9);
+	corpus = version_corpus_load_file(test_path, 0, 0);
+	errors += check(corpus != NULL && version_corpus_size(corpus) == 3, "newline delimited, no final newline");
+	if (corpus != NULL) {
+		errors += check(strcmp(get_version(corpus, 0, buffer, sizeof(buffer)), "1.0") == 0, "carriage return stripped");
+		errors += check(strcmp(get_version(corpus, 1, buffer, sizeof(buffer)), "") == 0, "empty record");
+		version_corpus_free(corpus);
+	}
+
+	write_file("1.0\0002.0\0003.0\000", 12);
+	corpus = version_corpus_load_file(test_path, VERSIONCORPUS_NUL_DELIMITED, 0);
+	errors += check(corpus != NULL && version_corpus_size(corpus) == 3, "NUL delimited");
+	if (corpus != NULL) {
+		errors += check(strcmp(get_version(corpus, 2, buffer, sizeof(buffer)), "3.0") == 0, "last NUL delimited record");
+		version_corpus_free(corpus);
+	}
+
+	write_file("", 0);
+	corpus = version_corpus_load_file(test_path, 0, 0);
+	errors += check(corpus != NULL && version_corpus_size(corpus) == 0, "empty file");
+	version_corpus_free(corpus);
+
+	remove(test_path);
+	errors += check(version_corpus_load_file(test_path, 0, 0) == NULL, "missing file");
+
+	return errors;
+}
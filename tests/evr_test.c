@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/evr.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_LENGTH 256
+#define TEXT_LENGTH 64
+#define NUM_RANDOM 400
+
+static int sign(int v) {
+	return (v > 0) - (v < 0);
+}
+
+static int compare_keys(const char* v1, const char* v2) {
+	unsigned char k1[KEY_LENGTH], k2[KEY_LENGTH];
+	size_t l1 = version_evr_key(v1, 0, k1, sizeof(k1));
+	size_t l2 = version_evr_key(v2, 0, k2, sizeof(k2));
+	int res = memcmp(k1, k2, l1 < l2 ? l1 : l2);
+
+	return res != 0 ? sign(res) : (l1 > l2) - (l1 < l2);
+}
+
+static int expectation_test(const char* v1, const char* v2, int expected) {
+	int res = version_evr_compare(v1, v2, 0, 0), key_res = compare_keys(v1, v2);
+
+	if (res != expected || key_res != expected) {
+		fprintf(stderr, "[FAIL] \"%s\" vs \"%s\": compare %d, keys %d, expected %d\n", v1, v2, res, key_res, expected);
+		return 1;
+	}
+
+	fprintf(stderr, "[ OK ] \"%s\" vs \"%s\": %d\n", v1, v2, res);
+	return 0;
+}
+
+/* splits into NUL terminated copies and compares them one by one */
+static int reference_compare(const char* v1, const char* v2) {
+	char e1[TEXT_LENGTH], e2[TEXT_LENGTH], r1[TEXT_LENGTH], r2[TEXT_LENGTH];
+	const char* colon;
+	const char* hyphen;
+	const char* vs[2] = { v1, v2 };
+	char* es[2] = { e1, e2 };
+	char* rs[2] = { r1, r2 };
+	char versions[2][TEXT_LENGTH];
+	int i, res;
+
+	for (i = 0; i < 2; i++) {
+		colon = strchr(vs[i], ':');
+		strcpy(es[i], "0");
+		if (colon != NULL && strspn(vs[i], "0123456789") == (size_t)(colon - vs[i])) {
+			memcpy(es[i], vs[i], colon - vs[i]);
+			es[i][colon - vs[i]] = '\0';
+			vs[i] = colon + 1;
+		}
+		hyphen = strrchr(vs[i], '-');
+		strcpy(rs[i], hyphen ? hyphen + 1 : "");
+		memcpy(versions[i], vs[i], hyphen ? (size_t)(hyphen - vs[i]) : strlen(vs[i]));
+		versions[i][hyphen ? (size_t)(hyphen - vs[i]) : strlen(vs[i])] = '\0';
+	}
+
+	/* epoch as a single numeric component compares numerically */
+	if ((res = version_compare2(e1, e2)) != 0)
+		return res;
+	if ((res = version_compare2(versions[0], versions[1])) != 0)
+		return res;
+	return version_compare2(r1, r2);
+}
+
+static unsigned next_random(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+static void generate(char* buffer, size_t size, unsigned* seed) {
+	static const char* epochs[] = { "", "0:", "1:", "01:", "2:", "10:" };
+	static const char* versions[] = { "1.0", "1", "1.0.0", "1.0a", "1.0alpha1", "1.0-rc1", "1.1", "1.0p1", "2", "1.0.1" };
+	static const char* releases[] = { "", "-0", "-1", "-1.el8", "-2", "-10", "-1a", "-0.1", "-1~beta" };
+
+	snprintf(buffer, size, "%s%s%s", epochs[next_random(seed) % 6], versions[next_random(seed) % 10], releases[next_random(seed) % 9]);
+}
+
+static int random_test(void) {
+	char (*evrs)[TEXT_LENGTH] = malloc(NUM_RANDOM * TEXT_LENGTH);
+	unsigned seed = 42;
+	size_t i, j;
+	int expected, ok = 1;
+
+	for (i = 0; i < NUM_RANDOM; i++)
+		generate(evrs[i], TEXT_LENGTH, &seed);
+
+	for (i = 0; i < NUM_RANDOM && ok; i++) {
+		for (j = 0; j < NUM_RANDOM && ok; j++) {
+			expected = reference_compare(evrs[i], evrs[j]);
+			if (version_evr_compare(evrs[i], evrs[j], 0, 0) != expected || compare_keys(evrs[i], evrs[j]) != expected) {
+				fprintf(stderr, "       \"%s\" vs \"%s\": compare %d, keys %d, expected %d\n", evrs[i], evrs[j], version_evr_compare(evrs[i], evrs[j], 0, 0), compare_keys(evrs[i], evrs[j]), expected);
+				ok = 0;
+			}
+		}
+	}
+
+	fprintf(stderr, "[%s] %d random versions agree with segment by segment comparison\n", ok ? " OK " : "FAIL", NUM_RANDOM);
+
+	free(evrs);
+	return !ok;
+}
+
+int main() {
+	int errors = 0;
+
+	fprintf(stderr, "Test group: epoch\n");
+	errors += expectation_test("1:1.0-1", "2.0-1", 1);
+	errors += expectation_test("0:1.0-1", "1.0-1", 0);
+	errors += expectation_test("00:1.0-1", "1.0-1", 0);
+	errors += expectation_test("2:1.0", "10:1.0", -1);
+	errors += expectation_test("99999999999999999999:1.0", "100000000000000000000:0.1", -1);
+
+	fprintf(stderr, "\nTest group: version and release\n");
+	errors += expectation_test("1.0-2", "1.0-1", 1);
+	errors += expectation_test("1.0-10", "1.0-9", 1);
+	errors += expectation_test("1.0", "1.0-0", 0);
+	errors += expectation_test("1.0-1", "1.0.0-1", 0);
+	errors += expectation_test("1.0-1", "1.0.1-0", -1);
+	errors += expectation_test("1.0a-1", "1.0-1", 1);
+	errors += expectation_test("1.0alpha-9", "1.0-1", -1);
+	errors += expectation_test("1.0-rc1-1", "1.0-1", -1);
+	errors += expectation_test("a:1.0", "1.0", -1);
+
+	fprintf(stderr, "\nTest group: agreement with segment by segment comparison\n");
+	errors += random_test();
+
+	return errors;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/filter.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_MEMBERS 10000
+#define NUM_PROBES 100000
+#define BITS_PER_VERSION 10
+#define FILTER_FILE "filter_test.tmp"
+
+static int hash_consistency_test(void) {
+	static const char* versions[] = {
+		"", "0", "0.0", "1", "1.0", "1.00", "01.0", "1.0.0.0", "1.0.1", "1.1",
+		"1.0a", "1.0A", "1.0alpha", "1.0.alpha", "1.0b", "1.0beta1", "1.0pre1",
+		"1.0p1", "1.0patch1", "1.0post1", "1.0pl1", "1a", "1.a", "1.0.a",
+		"10", "010", "1.10", "1.01", "1.0rc1", "1.0.rc.1", "1.0-rc-1",
+		"99999999999999999999999999", "0099999999999999999999999999",
+	};
+	static const int flags[] = { 0, VERSIONFLAG_P_IS_PATCH, VERSIONFLAG_ANY_IS_PATCH, VERSIONFLAG_LOWER_BOUND, VERSIONFLAG_UPPER_BOUND };
+	size_t i, j, k, l, num_versions = sizeof(versions) / sizeof(versions[0]), num_flags = sizeof(flags) / sizeof(flags[0]);
+	int equal_versions, equal_hashes, errors = 0;
+
+	for (k = 0; k < num_flags; k++) {
+		for (l = 0; l < num_flags; l++) {
+			for (i = 0; i < num_versions; i++) {
+				for (j = 0; j < num_versions; j++) {
+					equal_versions = version_compare4(versions[i], versions[j], flags[k], flags[l]) == 0;
+					equal_hashes = version_hash(versions[i], flags[k]) == version_hash(versions[j], flags[l]);
+					if (equal_versions != equal_hashes) {
+						fprintf(stderr, "[FAIL] \"%s\" (flags %d) and \"%s\" (flags %d): versions are %s, hashes are %s\n", versions[i], flags[k], versions[j], flags[l], equal_versions ? "equal" : "different", equal_hashes ? "equal" : "different");
+						errors++;
+					}
+				}
+			}
+		}
+	}
+
+	if (errors == 0)
+		fprintf(stderr, "[ OK ] hashes of equal versions are equal, hashes of different versions differ\n");
+
+	return errors;
+}
+
+static int membership_test(const char* name, const version_filter_t* filter) {
+	char buffer[64];
+	size_t i, false_positives = 0;
+	int ok = 1;
+
+	/* every member is found, including different spellings of it */
+	for (i = 0; i < NUM_MEMBERS && ok; i++) {
+		snprintf(buffer, sizeof(buffer), "%u.%u.%u", (unsigned)(i / 100), (unsigned)(i % 100), 0);
+		if (!version_filter_contains(filter, buffer, 0))
+			ok = 0;
+		snprintf(buffer, sizeof(buffer), "%u.%02u", (unsigned)(i / 100), (unsigned)(i % 100));
+		if (!version_filter_contains(filter, buffer, 0))
+			ok = 0;
+	}
+
+	for (i = 0; i < NUM_PROBES; i++) {
+		snprintf(buffer, sizeof(buffer), "%u.%u.1", (unsigned)(i / 100), (unsigned)(i % 100));
+		false_positives += version_filter_contains(filter, buffer, 0);
+	}
+
+	/* expected false positive rate for 10 bits per version is about 1%, allow some headroom for blocking */
+	if (false_positives * 100 > NUM_PROBES * 2)
+		ok = 0;
+
+	fprintf(stderr, "[%s] %s: no false negatives, %.2f%% false positives\n", ok ? " OK " : "FAIL", name, 100.0 * false_positives / NUM_PROBES);
+
+	return !ok;
+}
+
+int main() {
+	version_filter_t* filter;
+	version_filter_t* view;
+	unsigned char* serialized;
+	size_t length, i;
+	char buffer[64];
+	FILE* file;
+	int errors = 0;
+
+	fprintf(stderr, "Test group: canonical hash\n");
+	errors += hash_consistency_test();
+
+	fprintf(stderr, "\nTest group: filter\n");
+
+	filter = version_filter_create(NUM_MEMBERS, BITS_PER_VERSION);
+	for (i = 0; i < NUM_MEMBERS; i++) {
+		snprintf(buffer, sizeof(buffer), "%u.%u", (unsigned)(i / 100), (unsigned)(i % 100));
+		version_filter_add(filter, buffer, 0);
+	}
+	errors += membership_test("created filter", filter);
+
+	length = version_filter_serialize(filter, NULL, 0);
+	serialized = malloc(length);
+	version_filter_serialize(filter, serialized, length);
+
+	view = version_filter_view(serialized, length);
+	if (view == NULL) {
+		fprintf(stderr, "[FAIL] view creation failed\n");
+		errors++;
+	} else {
+		errors += membership_test("view", view);
+		if (version_filter_add(view, "1.0", 0)) {
+			fprintf(stderr, "[FAIL] view is modifiable\n");
+			errors++;
+		}
+		version_filter_free(view);
+	}
+
+	if ((file = fopen(FILTER_FILE, "wb")) == NULL || fwrite(serialized, 1, length, file) != length || fclose(file) != 0) {
+		fprintf(stderr, "[FAIL] cannot write %s\n", FILTER_FILE);
+		errors++;
+	} else if ((view = version_filter_open_file(FILTER_FILE)) == NULL) {
+		fprintf(stderr, "[FAIL] cannot open %s\n", FILTER_FILE);
+		errors++;
+	} else {
+		errors += membership_test("file", view);
+		version_filter_free(view);
+	}
+	remove(FILTER_FILE);
+
+	serialized[0] ^= 1;
+	if (version_filter_view(serialized, length) != NULL || version_filter_view(serialized, length - 1) != NULL) {
+		fprintf(stderr, "[FAIL] malformed filter accepted\n");
+		errors++;
+	} else {
+		fprintf(stderr, "[ OK ] malformed filter rejected\n");
+	}
+
+	free(serialized);
+	version_filter_free(filter);
+
+	return errors;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/sort.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXT_LENGTH 64
+#define KEY_LENGTH (2 * TEXT_LENGTH + 1)
+#define MAX_WIDTH 40
+
+typedef struct {
+	char text[TEXT_LENGTH];
+	unsigned char key[KEY_LENGTH];
+	size_t key_length;
+} version_t;
+
+typedef struct {
+	unsigned char key[MAX_WIDTH];
+	size_t index;
+} element_t;
+
+static unsigned next_random(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+/* mix of short versions, and long ones which overflow fixed keys and only differ in the tail */
+static void generate(char* buffer, size_t size, unsigned* seed) {
+	static const char* suffixes[] = { "", ".0", "a", "alpha1", "-rc2", "pl1" };
+
+	if (next_random(seed) % 2)
+		snprintf(buffer, size, "%u.%u%s", next_random(seed) % 3, next_random(seed) % 15, suffixes[next_random(seed) % 6]);
+	else
+		snprintf(buffer, size, "1.2.3.4.5.6.7.8.9.10.11.12.13.14.15.16.20240101.%u%s", next_random(seed) % 20, suffixes[next_random(seed) % 6]);
+}
+
+static void fill(version_t* versions, size_t count) {
+	unsigned seed = 42;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		generate(versions[i].text, TEXT_LENGTH, &seed);
+		versions[i].key_length = version_key(versions[i].text, 0, versions[i].key, KEY_LENGTH);
+	}
+}
+
+static int compare_keys(const version_t* a, const version_t* b) {
+	int res = memcmp(a->key, b->key, a->key_length < b->key_length ? a->key_length : b->key_length);
+
+	if (res == 0)
+		res = (a->key_length > b->key_length) - (a->key_length < b->key_length);
+	return res;
+}
+
+static int compare_versions(const version_t* a, const version_t* b) {
+	int res = compare_keys(a, b);
+
+	if (res == 0)
+		res = strcmp(a->text, b->text);
+	return res;
+}
+
+static int compare_reference(const void* a, const void* b) {
+	return compare_versions((const version_t*)a, (const version_t*)b);
+}
+
+static int tiebreak(const void* a, const void* b, void* userdata) {
+	const version_t* versions = (const version_t*)userdata;
+	return compare_versions(&versions[((const element_t*)a)->index], &versions[((const element_t*)b)->index]);
+}
+
+static int sign(int v) {
+	return (v > 0) - (v < 0);
+}
+
+static int key_test(size_t count, size_t width) {
+	version_t* versions = malloc(count * sizeof(version_t));
+	unsigned char* keys = malloc(count * width);
+	size_t i, j, length;
+	int ok = 1, res, expected;
+
+	fill(versions, count);
+
+	for (i = 0; i < count && ok; i++) {
+		length = version_key_fixed(versions[i].text, 0, keys + i * width, width);
+		if (length != versions[i].key_length || VERSION_KEY_FIXED_OVERFLOW(keys + i * width, width) != (length > width - 1))
+			ok = 0;
+	}
+
+	/* fixed keys order versions the same way as full keys, except for ties between overflowed keys */
+	for (i = 0; i < count && ok; i++) {
+		for (j = 0; j < count && ok; j++) {
+			res = sign(memcmp(keys + i * width, keys + j * width, width));
+			expected = sign(version_compare4(versions[i].text, versions[j].text, 0, 0));
+			if (res != expected && !(res == 0 && VERSION_KEY_FIXED_OVERFLOW(keys + i * width, width)))
+				ok = 0;
+		}
+	}
+
+	fprintf(stderr, "[%s] fixed keys, %d versions, width %d\n", ok ? " OK " : "FAIL", (int)count, (int)width);
+
+	free(versions);
+	free(keys);
+	return !ok;
+}
+
+static int sort_test(size_t count, size_t width, int with_tiebreak) {
+	version_t* versions = malloc(count * sizeof(version_t));
+	version_t* expected = malloc(count * sizeof(version_t));
+	element_t* elements = malloc(count * sizeof(element_t));
+	size_t i;
+	int ok = 1, res;
+
+	fill(versions, count);
+	for (i = 0; i < count; i++) {
+		version_key_fixed(versions[i].text, 0, elements[i].key, width);
+		elements[i].index = i;
+	}
+
+	memcpy(expected, versions, count * sizeof(version_t));
+	qsort(expected, count, sizeof(version_t), compare_reference);
+
+	if (!version_sort_fixed(elements, count, sizeof(element_t), width, with_tiebreak ? tiebreak : NULL, versions))
+		ok = 0;
+
+	for (i = 0; i < count && ok; i++) {
+		if (with_tiebreak) {
+			/* fully sorted; ties between equal keys which fit are left in original order */
+			if (compare_keys(&versions[elements[i].index], &expected[i]) != 0)
+				ok = 0;
+		} else if (i > 0) {
+			/* sorted by fixed keys, and stable */
+			res = memcmp(elements[i - 1].key, elements[i].key, width);
+			if (res > 0 || (res == 0 && elements[i - 1].index > elements[i].index))
+				ok = 0;
+		}
+	}
+
+	fprintf(stderr, "[%s] fixed sort, %d elements, width %d, %s tiebreak\n", ok ? " OK " : "FAIL", (int)count, (int)width, with_tiebreak ? "with" : "without");
+
+	free(versions);
+	free(expected);
+	free(elements);
+	return !ok;
+}
+
+int main() {
+	static const size_t counts[] = { 0, 1, 2, 7, 8, 9, 100, 5000 };
+	static const size_t widths[] = { 12, 16, 24, 32, 40 };
+	size_t icount, iwidth;
+	int errors = 0;
+
+	fprintf(stderr, "Test group: fixed keys\n");
+	for (iwidth = 0; iwidth < sizeof(widths) / sizeof(widths[0]); iwidth++)
+		errors += key_test(300, widths[iwidth]);
+
+	fprintf(stderr, "\nTest group: fixed key sort\n");
+	for (icount = 0; icount < sizeof(counts) / sizeof(counts[0]); icount++) {
+		for (iwidth = 0; iwidth < sizeof(widths) / sizeof(widths[0]); iwidth++) {
+			errors += sort_test(counts[icount], widths[iwidth], 1);
+			errors += sort_test(counts[icount], widths[iwidth], 0);
+		}
+	}
+
+	return errors;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/version.h>
+
+#include <stdio.h>
+#include <string.h>
+
+static char kind_to_char(int kind) {
+	return kind == VERSIONCOMPONENT_NUMERIC ? 'n' : 'a';
+}
+
+/* formats components as space separated list of <kind><metaorder>:<text> */
+static void format_components(const char* v, const version_component_t* components, size_t count, char* buffer, size_t size) {
+	size_t i;
+	int written;
+
+	buffer[0] = '\0';
+	for (i = 0; i < count; i++) {
+		written = snprintf(buffer, size, "%s%c%d:%.*s", i == 0 ? "" : " ", kind_to_char(components[i].kind), components[i].metaorder, (int)components[i].length, v + components[i].offset);
+		if (written < 0 || (size_t)written >= size)
+			return;
+		buffer += written;
+		size -= written;
+	}
+}
+
+static int tokenize_test(const char* v, int flags, const char* expected) {
+	version_component_t components[16];
+	char buffer[256];
+	size_t count = version_tokenize(v, flags, components, 16);
+
+	format_components(v, components, count, buffer, sizeof(buffer));
+
+	if (strcmp(buffer, expected) == 0) {
+		fprintf(stderr, "[ OK ] \"%s\" (0x%x) -> \"%s\"\n", v, flags, buffer);
+		return 0;
+	} else {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x) -> \"%s\": expected \"%s\"\n", v, flags, buffer, expected);
+		return 1;
+	}
+}
+
+static int iter_test(const char* v, int flags) {
+	version_component_t expected[16], component;
+	version_iter_t iter;
+	size_t count = version_tokenize(v, flags, expected, 16);
+	size_t i = 0;
+
+	version_iter_init(&iter, v, flags);
+	while (version_iter_next(&iter, &component)) {
+		if (i >= count || memcmp(&component, &expected[i], sizeof(component)) != 0) {
+			fprintf(stderr, "[FAIL] \"%s\" (0x%x): iterator differs from tokenizer at component %d\n", v, flags, (int)i);
+			return 1;
+		}
+		i++;
+	}
+
+	if (i != count) {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x): iterator produced %d components, tokenizer %d\n", v, flags, (int)i, (int)count);
+		return 1;
+	}
+
+	fprintf(stderr, "[ OK ] \"%s\" (0x%x): iterator matches tokenizer\n", v, flags);
+	return 0;
+}
+
+static int capacity_test(const char* v, size_t capacity, size_t expected) {
+	version_component_t components[4];
+	size_t count;
+
+	memset(components, 0xff, sizeof(components));
+	count = version_tokenize(v, 0, components, capacity);
+
+	if (count != expected) {
+		fprintf(stderr, "[FAIL] \"%s\" capacity %d: got count %d, expected %d\n", v, (int)capacity, (int)count, (int)expected);
+		return 1;
+	}
+	if (capacity < 4 && components[capacity].length != (size_t)-1) {
+		fprintf(stderr, "[FAIL] \"%s\" capacity %d: component written past capacity\n", v, (int)capacity);
+		return 1;
+	}
+
+	fprintf(stderr, "[ OK ] \"%s\" capacity %d: count %d\n", v, (int)capacity, (int)count);
+	return 0;
+}
+
+int main() {
+	int errors = 0;
+
+	fprintf(stderr, "Test group: basic tokenization\n");
+	errors += tokenize_test("", 0, "");
+	errors += tokenize_test("...", 0, "");
+	errors += tokenize_test("1", 0, "n4:1");
+	errors += tokenize_test("1.2.3", 0, "n4:1 n4:2 n4:3");
+	errors += tokenize_test("..1..2..", 0, "n4:1 n4:2");
+
+	fprintf(stderr, "\nTest group: leading zeroes are not included\n");
+	errors += tokenize_test("0", 0, "n2:");
+	errors += tokenize_test("1.000.0010", 0, "n4:1 n2: n4:10");
+
+	fprintf(stderr, "\nTest group: alphabetic components\n");
+	errors += tokenize_test("1.0alpha1", 0, "n4:1 n2: a1:alpha n4:1");
+	errors += tokenize_test("1.0patch1", 0, "n4:1 n2: a3:patch n4:1");
+	errors += tokenize_test("1.0a", 0, "n4:1 n2: a5:a");
+	errors += tokenize_test("1.0a.1", 0, "n4:1 n2: a5:a n4:1");
+	errors += tokenize_test("1.0beta", 0, "n4:1 n2: a1:beta");
+	errors += tokenize_test("0a1", 0, "n2: a1:a n4:1");
+
+	fprintf(stderr, "\nTest group: flags\n");
+	errors += tokenize_test("1.0p1", 0, "n4:1 n2: a1:p n4:1");
+	errors += tokenize_test("1.0p1", VERSIONFLAG_P_IS_PATCH, "n4:1 n2: a3:p n4:1");
+	errors += tokenize_test("1.0foo1", VERSIONFLAG_ANY_IS_PATCH, "n4:1 n2: a3:foo n4:1");
+	errors += tokenize_test("1.0", VERSIONFLAG_LOWER_BOUND, "n4:1 n2:");
+	errors += tokenize_test("1.0", VERSIONFLAG_UPPER_BOUND, "n4:1 n2:");
+
+	fprintf(stderr, "\nTest group: iterator\n");
+	errors += iter_test("", 0);
+	errors += iter_test("1.2a.3b4c-rc1", 0);
+	errors += iter_test("1.0p1", VERSIONFLAG_P_IS_PATCH);
+
+	fprintf(stderr, "\nTest group: capacity\n");
+	errors += capacity_test("1.2.3", 0, 3);
+	errors += capacity_test("1.2.3", 2, 3);
+	errors += capacity_test("1.2.3", 4, 3);
+
+	return errors;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/version.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_KEY_LENGTH 1024
+
+static const int flag_sets[] = {
+	0,
+	VERSIONFLAG_P_IS_PATCH,
+	VERSIONFLAG_ANY_IS_PATCH,
+	VERSIONFLAG_LOWER_BOUND,
+	VERSIONFLAG_UPPER_BOUND,
+};
+static const size_t num_flag_sets = sizeof(flag_sets)/sizeof(flag_sets[0]);
+
+static int sign(int value) {
+	return value < 0 ? -1 : value > 0 ? 1 : 0;
+}
+
+static int compare_keys(const unsigned char* k1, size_t l1, const unsigned char* k2, size_t l2) {
+	int res = memcmp(k1, k2, l1 < l2 ? l1 : l2);
+	if (res != 0)
+		return sign(res);
+	return l1 < l2 ? -1 : l1 > l2 ? 1 : 0;
+}
+
+static int key_test(const char* v1, const char* v2, int flags1, int flags2) {
+	unsigned char k1[MAX_KEY_LENGTH], k2[MAX_KEY_LENGTH];
+	size_t l1 = version_key(v1, flags1, k1, sizeof(k1));
+	size_t l2 = version_key(v2, flags2, k2, sizeof(k2));
+	int expected = version_compare4(v1, v2, flags1, flags2);
+	int result = compare_keys(k1, l1, k2, l2);
+
+	if (l1 > VERSION_KEY_MAX_LENGTH(strlen(v1)) || l2 > VERSION_KEY_MAX_LENGTH(strlen(v2))) {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x) / \"%s\" (0x%x): key length exceeds the limit\n", v1, flags1, v2, flags2);
+		return 1;
+	}
+
+	if (result != expected) {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x) vs. \"%s\" (0x%x): keys compare as %d, versions as %d\n", v1, flags1, v2, flags2, result, expected);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int multi_test(const char* v) {
+	static const int multi_flag_sets[] = {
+		0,
+		VERSIONFLAG_P_IS_PATCH,
+		VERSIONFLAG_ANY_IS_PATCH,
+		VERSIONFLAG_P_IS_PATCH | VERSIONFLAG_ANY_IS_PATCH,
+		VERSIONFLAG_LOWER_BOUND,
+		VERSIONFLAG_P_IS_PATCH | VERSIONFLAG_UPPER_BOUND,
+		VERSIONFLAG_ANY_IS_PATCH | VERSIONFLAG_LOWER_BOUND,
+	};
+	enum { num_schemes = sizeof(multi_flag_sets)/sizeof(multi_flag_sets[0]) };
+	unsigned char storage[num_schemes][MAX_KEY_LENGTH], expected[MAX_KEY_LENGTH];
+	unsigned char* keys[num_schemes];
+	size_t lengths[num_schemes], expected_length, max_length = 0, max_result, i;
+
+	for (i = 0; i < num_schemes; i++)
+		keys[i] = storage[i];
+
+	max_result = version_key_multi(v, multi_flag_sets, num_schemes, keys, MAX_KEY_LENGTH, lengths);
+
+	for (i = 0; i < num_schemes; i++) {
+		expected_length = version_key(v, multi_flag_sets[i], expected, sizeof(expected));
+		if (lengths[i] != expected_length || memcmp(keys[i], expected, expected_length) != 0) {
+			fprintf(stderr, "[FAIL] \"%s\" (0x%x): key differs from single scheme key\n", v, multi_flag_sets[i]);
+			return 1;
+		}
+		if (expected_length > max_length)
+			max_length = expected_length;
+	}
+
+	if (max_result != max_length) {
+		fprintf(stderr, "[FAIL] \"%s\": returned length %d, expected %d\n", v, (int)max_result, (int)max_length);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int capacity_test(const char* v) {
+	unsigned char full[MAX_KEY_LENGTH], partial[MAX_KEY_LENGTH];
+	size_t length = version_key(v, 0, full, sizeof(full));
+	size_t i;
+
+	for (i = 0; i < length; i++) {
+		memset(partial, 0xaa, sizeof(partial));
+		if (version_key(v, 0, partial, i) != length || memcmp(full, partial, i) != 0 || partial[i] != 0xaa) {
+			fprintf(stderr, "[FAIL] \"%s\": truncated key with capacity %d is incorrect\n", v, (int)i);
+			return 1;
+		}
+	}
+
+	fprintf(stderr, "[ OK ] \"%s\": truncated keys are correct\n", v);
+	return 0;
+}
+
+int main() {
+	const char version_chars[] = { '0', '1', '9', 'a', 'p', 'R', '.', '-' };
+	const size_t num_version_chars = sizeof(version_chars)/sizeof(version_chars[0]);
+
+	const char* samples[] = {
+		"", "0", "1", "1.0", "1.0.0", "9", "10", "00100", "a", "r", "z",
+		"1a", "1.a", "1.0a", "1alpha1", "1patch1", "1.0p1", "1.0pre1", "1.0.a",
+		"99999999999999999999", "100000000000000000000",
+		NULL, NULL,
+	};
+	const size_t num_samples = sizeof(samples)/sizeof(samples[0]);
+
+	char long_number1[300], long_number2[300], buffer[5];
+	size_t length, pos, isample, iflags1, iflags2;
+	int errors = 0, multi_errors;
+
+	/* numbers which do not fit into short key form */
+	memset(long_number1, '9', 250);
+	long_number1[250] = '\0';
+	memset(long_number2, '0', 251);
+	long_number2[0] = '1';
+	long_number2[251] = '\0';
+	samples[num_samples - 2] = long_number1;
+	samples[num_samples - 1] = long_number2;
+
+	fprintf(stderr, "Test group: key order matches version order\n");
+	for (length = 0; length <= 4; length++) {
+		size_t combination, num_combinations = 1;
+		for (pos = 0; pos < length; pos++)
+			num_combinations *= num_version_chars;
+
+		for (combination = 0; combination < num_combinations; combination++) {
+			size_t rest = combination;
+			for (pos = 0; pos < length; pos++) {
+				buffer[pos] = version_chars[rest % num_version_chars];
+				rest /= num_version_chars;
+			}
+			buffer[length] = '\0';
+
+			for (isample = 0; isample < num_samples; isample++)
+				for (iflags1 = 0; iflags1 < num_flag_sets; iflags1++)
+					for (iflags2 = 0; iflags2 < num_flag_sets; iflags2++)
+						errors += key_test(buffer, samples[isample], flag_sets[iflags1], flag_sets[iflags2]);
+		}
+	}
+	for (isample = 0; isample < num_samples; isample++)
+		for (pos = 0; pos < num_samples; pos++)
+			for (iflags1 = 0; iflags1 < num_flag_sets; iflags1++)
+				for (iflags2 = 0; iflags2 < num_flag_sets; iflags2++)
+					errors += key_test(samples[isample], samples[pos], flag_sets[iflags1], flag_sets[iflags2]);
+	if (errors == 0)
+		fprintf(stderr, "[ OK ] all combinations\n");
+
+	fprintf(stderr, "\nTest group: multiple schemes\n");
+	multi_errors = errors;
+	for (length = 0; length <= 4; length++) {
+		size_t combination, num_combinations = 1;
+		for (pos = 0; pos < length; pos++)
+			num_combinations *= num_version_chars;
+
+		for (combination = 0; combination < num_combinations; combination++) {
+			size_t rest = combination;
+			for (pos = 0; pos < length; pos++) {
+				buffer[pos] = version_chars[rest % num_version_chars];
+				rest /= num_version_chars;
+			}
+			buffer[length] = '\0';
+			errors += multi_test(buffer);
+		}
+	}
+	for (isample = 0; isample < num_samples; isample++)
+		errors += multi_test(samples[isample]);
+	if (errors == multi_errors)
+		fprintf(stderr, "[ OK ] keys match single scheme keys\n");
+
+	fprintf(stderr, "\nTest group: capacity\n");
+	errors += capacity_test("1.2.3alpha4");
+	errors += capacity_test(long_number2);
+
+	return errors;
+}
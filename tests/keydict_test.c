@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/keydict.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COUNT 600
+#define TEXT_LENGTH 64
+#define KEY_LENGTH (2 * TEXT_LENGTH + 1)
+#define CKEY_LENGTH VERSION_KEYDICT_MAX_LENGTH(KEY_LENGTH)
+
+typedef struct {
+	char text[TEXT_LENGTH];
+	unsigned char key[KEY_LENGTH];
+	size_t key_length;
+	unsigned char ckey[CKEY_LENGTH];
+	size_t ckey_length;
+} version_t;
+
+static unsigned next_random(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+/* long snapshot versions sharing components, with some ordinary versions mixed in */
+static void generate(char* buffer, size_t size, unsigned* seed) {
+	static const char* suffixes[] = { "", ".0", "a", "alpha1", "-rc2", "pl1", ".post1" };
+
+	switch (next_random(seed) % 4) {
+	case 0:
+		snprintf(buffer, size, "%u.%u%s", next_random(seed) % 3, next_random(seed) % 15, suffixes[next_random(seed) % 7]);
+		break;
+	case 1:
+		snprintf(buffer, size, "%u", next_random(seed));
+		break;
+	default:
+		snprintf(buffer, size, "%u.%u.%u.20240%u%02u.git%u%s", next_random(seed) % 2, 10 + next_random(seed) % 3, next_random(seed) % 20, 1 + next_random(seed) % 9, 1 + next_random(seed) % 28, next_random(seed) % 1000, suffixes[next_random(seed) % 7]);
+		break;
+	}
+}
+
+static int sign(int v) {
+	return (v > 0) - (v < 0);
+}
+
+static int compare_keys(const unsigned char* k1, size_t l1, const unsigned char* k2, size_t l2) {
+	int res = memcmp(k1, k2, l1 < l2 ? l1 : l2);
+	return res != 0 ? sign(res) : (l1 > l2) - (l1 < l2);
+}
+
+static int compression_test(const char* name, version_t* versions, const version_keydict_t* dict) {
+	unsigned char decompressed[KEY_LENGTH];
+	size_t i, j, key_bytes = 0, ckey_bytes = 0;
+	int ok = 1;
+
+	for (i = 0; i < COUNT; i++) {
+		versions[i].ckey_length = version_keydict_compress(dict, versions[i].key, versions[i].key_length, versions[i].ckey, CKEY_LENGTH);
+		key_bytes += versions[i].key_length;
+		ckey_bytes += versions[i].ckey_length;
+
+		if (versions[i].ckey_length > CKEY_LENGTH)
+			ok = 0;
+		else if (version_keydict_decompress(dict, versions[i].ckey, versions[i].ckey_length, decompressed, KEY_LENGTH) != versions[i].key_length)
+			ok = 0;
+		else if (memcmp(decompressed, versions[i].key, versions[i].key_length) != 0)
+			ok = 0;
+	}
+
+	/* compressed keys compare the same way as original keys */
+	for (i = 0; i < COUNT && ok; i++)
+		for (j = 0; j < COUNT && ok; j++)
+			if (compare_keys(versions[i].ckey, versions[i].ckey_length, versions[j].ckey, versions[j].ckey_length) != compare_keys(versions[i].key, versions[i].key_length, versions[j].key, versions[j].key_length))
+				ok = 0;
+
+	fprintf(stderr, "[%s] %s: %d key bytes compressed to %d\n", ok ? " OK " : "FAIL", name, (int)key_bytes, (int)ckey_bytes);
+
+	return !ok;
+}
+
+int main() {
+	version_t* versions = malloc(COUNT * sizeof(version_t));
+	const unsigned char* keys[COUNT];
+	size_t lengths[COUNT];
+	unsigned char serialized[128 * 256];
+	size_t serialized_length, i;
+	version_keydict_t* dict;
+	version_keydict_t* restored;
+	unsigned seed = 42;
+	int errors = 0;
+
+	for (i = 0; i < COUNT; i++) {
+		generate(versions[i].text, TEXT_LENGTH, &seed);
+		versions[i].key_length = version_key(versions[i].text, 0, versions[i].key, KEY_LENGTH);
+		keys[i] = versions[i].key;
+		lengths[i] = versions[i].key_length;
+	}
+
+	fprintf(stderr, "Test group: order preserving compression\n");
+
+	dict = version_keydict_train(keys, lengths, 0);
+	errors += compression_test("empty dictionary", versions, dict);
+	version_keydict_free(dict);
+
+	dict = version_keydict_train(keys, lengths, COUNT);
+	errors += compression_test("trained dictionary", versions, dict);
+
+	fprintf(stderr, "\nTest group: serialization\n");
+
+	serialized_length = version_keydict_serialize(dict, serialized, sizeof(serialized));
+	restored = version_keydict_deserialize(serialized, serialized_length);
+	if (restored == NULL) {
+		fprintf(stderr, "[FAIL] deserialization failed\n");
+		errors++;
+	} else {
+		errors += compression_test("restored dictionary", versions, restored);
+		version_keydict_free(restored);
+	}
+
+	if (serialized_length > 1 && version_keydict_deserialize(serialized, serialized_length - 1) != NULL) {
+		fprintf(stderr, "[FAIL] truncated dictionary accepted\n");
+		errors++;
+	} else {
+		fprintf(stderr, "[ OK ] truncated dictionary rejected\n");
+	}
+
+	version_keydict_free(dict);
+	free(versions);
+
+	return errors;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/outdated.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXT_LENGTH 32
+#define NUM_RANDOM_ROWS 3000
+#define MAX_EXPECTATIONS 32
+
+typedef struct {
+	const char* package;
+	const char* version;
+	int status;
+} expectation_t;
+
+static const char* status_name(int status) {
+	switch (status) {
+	case VERSIONSTATUS_NEWEST: return "newest";
+	case VERSIONSTATUS_OUTDATED: return "outdated";
+	case VERSIONSTATUS_LEGACY: return "legacy";
+	}
+	return "?";
+}
+
+static void fill_row(version_outdated_row_t* row, const char* package, const char* version) {
+	row->package = package;
+	row->package_length = strlen(package);
+	row->version = version;
+	row->version_length = strlen(version);
+	row->status = -1;
+}
+
+static const expectation_t depth2_expectations[] = {
+	{ "foo", "1.0.1", VERSIONSTATUS_OUTDATED },
+	{ "foo", "1.0.2", VERSIONSTATUS_LEGACY },
+	{ "foo", "1.0.2.0", VERSIONSTATUS_LEGACY },
+	{ "foo", "1.1.0", VERSIONSTATUS_OUTDATED },
+	{ "foo", "1.1.3", VERSIONSTATUS_LEGACY },
+	{ "foo", "2.0.0", VERSIONSTATUS_NEWEST },
+	{ "foo", "2.0", VERSIONSTATUS_NEWEST },
+	{ "foo", "2.0.0alpha1", VERSIONSTATUS_OUTDATED },
+	{ "bar", "1.0.1", VERSIONSTATUS_LEGACY },
+	{ "bar", "1.0.0", VERSIONSTATUS_OUTDATED },
+	{ "bar", "0.9.5", VERSIONSTATUS_LEGACY },
+	{ "bar", "1.1pre1", VERSIONSTATUS_NEWEST },
+	{ "baz", "1.0", VERSIONSTATUS_NEWEST },
+	{ "qux", "1", VERSIONSTATUS_LEGACY },
+	{ "qux", "1.0", VERSIONSTATUS_LEGACY },
+	{ "qux", "1.1", VERSIONSTATUS_LEGACY },
+	{ "qux", "2.0", VERSIONSTATUS_NEWEST },
+	{ "quux", "1a1", VERSIONSTATUS_LEGACY },
+	{ "quux", "1.5", VERSIONSTATUS_LEGACY },
+	{ "quux", "2.0", VERSIONSTATUS_NEWEST },
+};
+
+/* last branch component is classified as in the full version, e.g. b in 1.0b2 stays a pre-release */
+static const expectation_t depth3_expectations[] = {
+	{ "foo", "1.0b2", VERSIONSTATUS_LEGACY },
+	{ "foo", "1.0.1", VERSIONSTATUS_LEGACY },
+	{ "foo", "2.0", VERSIONSTATUS_NEWEST },
+};
+
+static int expectations_test(const expectation_t* expectations, size_t count, int depth) {
+	version_outdated_row_t rows[MAX_EXPECTATIONS];
+	size_t i;
+	int errors = 0;
+
+	for (i = 0; i < count; i++)
+		fill_row(&rows[i], expectations[i].package, expectations[i].version);
+
+	if (!version_outdated_classify(rows, count, 0, depth, 2)) {
+		fprintf(stderr, "[FAIL] classification failed\n");
+		return 1;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (rows[i].status == expectations[i].status) {
+			fprintf(stderr, "[ OK ] %s %s is %s at depth %d\n", expectations[i].package, expectations[i].version, status_name(rows[i].status), depth);
+		} else {
+			fprintf(stderr, "[FAIL] %s %s is %s at depth %d, expected %s\n", expectations[i].package, expectations[i].version, status_name(rows[i].status), depth, status_name(expectations[i].status));
+			errors++;
+		}
+	}
+
+	return errors;
+}
+
+static unsigned next_random(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+/*
+ * rebuilds first depth components of version, padded with zeroes, as
+ * a release branch; components are joined so that each is classified
+ * the same way as in the version, e.g. 1a1 gives 1.a, while 1a.1 gives 1a
+ */
+static void get_branch(const char* version, int depth, char* branch) {
+	version_iter_t iter;
+	version_component_t component;
+	int num_components = 0;
+
+	branch[0] = '\0';
+
+	version_iter_init(&iter, version, 0);
+	while (num_components < depth && version_iter_next(&iter, &component)) {
+		if (num_components++ > 0 && component.metaorder != VERSIONMETAORDER_LETTER_SUFFIX)
+			strcat(branch, ".");
+		if (component.metaorder == VERSIONMETAORDER_ZERO)
+			strcat(branch, "0");
+		else
+			strncat(branch, version + component.offset, component.length);
+	}
+
+	for (; num_components < depth; num_components++)
+		strcat(branch, num_components > 0 ? ".0" : "0");
+}
+
+/* straightforward quadratic classification with version_compare4 */
+static int reference_status(char (*packages)[TEXT_LENGTH], char (*versions)[TEXT_LENGTH], size_t count, size_t index, int depth) {
+	char branch[2 * TEXT_LENGTH];
+	size_t i;
+	int newest = 1, branch_newest = 1;
+
+	get_branch(versions[index], depth, branch);
+
+	for (i = 0; i < count; i++) {
+		if (strcmp(packages[i], packages[index]) != 0 || version_compare2(versions[i], versions[index]) <= 0)
+			continue;
+		newest = 0;
+		if (depth == 0 || version_compare4(versions[i], branch, 0, VERSIONFLAG_UPPER_BOUND) <= 0)
+			branch_newest = 0;
+	}
+
+	return newest ? VERSIONSTATUS_NEWEST : branch_newest ? VERSIONSTATUS_LEGACY : VERSIONSTATUS_OUTDATED;
+}
+
+static int random_test(int depth, int threads) {
+	char (*packages)[TEXT_LENGTH] = malloc(NUM_RANDOM_ROWS * TEXT_LENGTH);
+	char (*versions)[TEXT_LENGTH] = malloc(NUM_RANDOM_ROWS * TEXT_LENGTH);
+	version_outdated_row_t* rows = malloc(NUM_RANDOM_ROWS * sizeof(version_outdated_row_t));
+	static const char* suffixes[] = { "", ".0", "a", "pre1", ".1", "-rc1", "b2", "a.1" };
+	unsigned seed = 42;
+	size_t i;
+	int ok = 1;
+
+	for (i = 0; i < NUM_RANDOM_ROWS; i++) {
+		snprintf(packages[i], TEXT_LENGTH, "package%u", next_random(&seed) % 100);
+		if (next_random(&seed) % 5 == 0)
+			snprintf(versions[i], TEXT_LENGTH, "%u%s", next_random(&seed) % 3, suffixes[next_random(&seed) % 8]);
+		else
+			snprintf(versions[i], TEXT_LENGTH, "%u.%u.%u%s", next_random(&seed) % 3, next_random(&seed) % 4, next_random(&seed) % 3, suffixes[next_random(&seed) % 8]);
+		fill_row(&rows[i], packages[i], versions[i]);
+	}
+
+	if (!version_outdated_classify(rows, NUM_RANDOM_ROWS, 0, depth, threads))
+		ok = 0;
+
+	for (i = 0; i < NUM_RANDOM_ROWS && ok; i++) {
+		if (rows[i].status != reference_status(packages, versions, NUM_RANDOM_ROWS, i, depth)) {
+			fprintf(stderr, "       %s %s is %s, expected %s\n", packages[i], versions[i], status_name(rows[i].status), status_name(reference_status(packages, versions, NUM_RANDOM_ROWS, i, depth)));
+			ok = 0;
+		}
+	}
+
+	fprintf(stderr, "[%s] %d random rows, branch depth %d, %d threads\n", ok ? " OK " : "FAIL", NUM_RANDOM_ROWS, depth, threads);
+
+	free(packages);
+	free(versions);
+	free(rows);
+	return !ok;
+}
+
+int main() {
+	int errors = 0;
+
+	fprintf(stderr, "Test group: classification\n");
+	errors += expectations_test(depth2_expectations, sizeof(depth2_expectations) / sizeof(depth2_expectations[0]), 2);
+	errors += expectations_test(depth3_expectations, sizeof(depth3_expectations) / sizeof(depth3_expectations[0]), 3);
+
+	fprintf(stderr, "\nTest group: agreement with pairwise comparison\n");
+	errors += random_test(0, 1);
+	errors += random_test(1, 1);
+	errors += random_test(2, 1);
+	errors += random_test(2, 4);
+	errors += random_test(3, 3);
+
+	return errors;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/sort.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXT_LENGTH 48
+#define KEY_LENGTH (2 * TEXT_LENGTH + 1)
+
+typedef struct {
+	char text[TEXT_LENGTH];
+	unsigned char key[KEY_LENGTH];
+} storage_t;
+
+typedef void (*generator_t)(char* buffer, size_t size, unsigned* seed);
+
+static unsigned next_random(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+/* short versions, fit into packed keys */
+static void generate_short(char* buffer, size_t size, unsigned* seed) {
+	snprintf(buffer, size, "%u.%u.%u", next_random(seed) % 4, next_random(seed) % 10, next_random(seed) % 10);
+}
+
+/* versions with long common prefixes */
+static void generate_snapshot(char* buffer, size_t size, unsigned* seed) {
+	snprintf(buffer, size, "1.2.3.4.5.6.20240101.%u", next_random(seed) % 100);
+}
+
+/* mixed versions with many duplicates and equal but differently spelled versions */
+static void generate_mixed(char* buffer, size_t size, unsigned* seed) {
+	static const char* suffixes[] = { "", ".0", "a", "alpha1", "-rc2", "pl1", "p", ".00" };
+	snprintf(buffer, size, "%u.%u%s", next_random(seed) % 3, next_random(seed) % 15, suffixes[next_random(seed) % 8]);
+}
+
+/* already sorted versions; seed is used as a counter */
+static void generate_ascending(char* buffer, size_t size, unsigned* seed) {
+	unsigned n = (*seed)++;
+	snprintf(buffer, size, "%u.%u", n / 10, n % 10);
+}
+
+static void generate_descending(char* buffer, size_t size, unsigned* seed) {
+	unsigned n = 100000 - (*seed)++;
+	snprintf(buffer, size, "%u.%u", n / 10, n % 10);
+}
+
+/* concatenation of sorted lists of 500 versions each */
+static void generate_concatenated(char* buffer, size_t size, unsigned* seed) {
+	unsigned n = (*seed)++;
+	snprintf(buffer, size, "%u.%u", n % 500, n / 500);
+}
+
+/* sorted versions with occasional out of place ones */
+static void generate_nearly_sorted(char* buffer, size_t size, unsigned* seed) {
+	unsigned n = (*seed)++;
+	if (n % 500 == 0)
+		snprintf(buffer, size, "%u.%u", n % 1000, n);
+	else
+		snprintf(buffer, size, "%u.%u", n / 10, n % 10);
+}
+
+static const char* engine_name(int engine) {
+	switch (engine) {
+	case VERSIONSORT_AUTO: return "auto";
+	case VERSIONSORT_COMPARISON: return "comparison";
+	case VERSIONSORT_RADIX: return "radix";
+	case VERSIONSORT_PACKED: return "packed";
+	case VERSIONSORT_NATURAL: return "natural";
+	}
+	return "?";
+}
+
+static int compare_reference(const void* a, const void* b) {
+	const version_sort_item_t* ia = (const version_sort_item_t*)a;
+	const version_sort_item_t* ib = (const version_sort_item_t*)b;
+	int res = memcmp(ia->key, ib->key, ia->key_length < ib->key_length ? ia->key_length : ib->key_length);
+
+	if (res == 0)
+		res = (ia->key_length > ib->key_length) - (ia->key_length < ib->key_length);
+	if (res == 0)
+		res = strcmp(ia->text, ib->text);
+	return res;
+}
+
+static void fill(storage_t* storage, version_sort_item_t* items, size_t count, generator_t generator) {
+	unsigned seed = 42;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		generator(storage[i].text, TEXT_LENGTH, &seed);
+		items[i].text = storage[i].text;
+		items[i].text_length = strlen(storage[i].text);
+		items[i].key = storage[i].key;
+		items[i].key_length = version_key(storage[i].text, 0, storage[i].key, KEY_LENGTH);
+	}
+}
+
+static int sort_test(const char* name, generator_t generator, size_t count, int engine) {
+	storage_t* storage = malloc(count * sizeof(storage_t));
+	version_sort_item_t* items = malloc(count * sizeof(version_sort_item_t));
+	version_sort_item_t* expected = malloc(count * sizeof(version_sort_item_t));
+	size_t* indexes = malloc(count * sizeof(size_t));
+	size_t i;
+	int ok = 1;
+
+	fill(storage, items, count, generator);
+	memcpy(expected, items, count * sizeof(version_sort_item_t));
+	qsort(expected, count, sizeof(version_sort_item_t), compare_reference);
+
+	/* permutation is checked against unsorted items, so it's computed first */
+	if (!version_sort_indexes(items, count, engine, indexes))
+		ok = 0;
+
+	for (i = 0; i < count && ok; i++)
+		if (indexes[i] >= count || compare_reference(&items[indexes[i]], &expected[i]) != 0)
+			ok = 0;
+
+	version_sort_items(items, count, engine);
+
+	for (i = 0; i < count && ok; i++)
+		if (compare_reference(&items[i], &expected[i]) != 0)
+			ok = 0;
+
+	fprintf(stderr, "[%s] %s, %d items, %s engine\n", ok ? " OK " : "FAIL", name, (int)count, engine_name(engine));
+
+	free(storage);
+	free(items);
+	free(expected);
+	free(indexes);
+	return !ok;
+}
+
+static int choice_test(const char* name, generator_t generator, size_t count, int expected) {
+	storage_t* storage = malloc(count * sizeof(storage_t));
+	version_sort_item_t* items = malloc(count * sizeof(version_sort_item_t));
+	int engine;
+
+	fill(storage, items, count, generator);
+	engine = version_sort_choose_engine(items, count);
+
+	free(storage);
+	free(items);
+
+	if (engine != expected) {
+		fprintf(stderr, "[FAIL] %s, %d items: chosen %s engine, expected %s\n", name, (int)count, engine_name(engine), engine_name(expected));
+		return 1;
+	}
+
+	fprintf(stderr, "[ OK ] %s, %d items: chosen %s engine\n", name, (int)count, engine_name(engine));
+	return 0;
+}
+
+int main() {
+	static const size_t counts[] = { 0, 1, 2, 17, 100, 5000 };
+	static const int engines[] = { VERSIONSORT_AUTO, VERSIONSORT_COMPARISON, VERSIONSORT_RADIX, VERSIONSORT_PACKED, VERSIONSORT_NATURAL };
+	size_t icount, iengine;
+	int errors = 0;
+
+	fprintf(stderr, "Test group: all engines produce correct order\n");
+	for (icount = 0; icount < sizeof(counts) / sizeof(counts[0]); icount++) {
+		for (iengine = 0; iengine < sizeof(engines) / sizeof(engines[0]); iengine++) {
+			errors += sort_test("short", generate_short, counts[icount], engines[iengine]);
+			errors += sort_test("snapshot", generate_snapshot, counts[icount], engines[iengine]);
+			errors += sort_test("mixed", generate_mixed, counts[icount], engines[iengine]);
+			errors += sort_test("ascending", generate_ascending, counts[icount], engines[iengine]);
+			errors += sort_test("descending", generate_descending, counts[icount], engines[iengine]);
+			errors += sort_test("concatenated", generate_concatenated, counts[icount], engines[iengine]);
+			errors += sort_test("nearly sorted", generate_nearly_sorted, counts[icount], engines[iengine]);
+		}
+	}
+
+	fprintf(stderr, "\nTest group: engine choice\n");
+	errors += choice_test("short", generate_short, 100, VERSIONSORT_COMPARISON);
+	errors += choice_test("short", generate_short, 5000, VERSIONSORT_PACKED);
+	errors += choice_test("snapshot", generate_snapshot, 5000, VERSIONSORT_RADIX);
+	errors += choice_test("mixed", generate_mixed, 5000, VERSIONSORT_PACKED);
+	errors += choice_test("ascending", generate_ascending, 5000, VERSIONSORT_NATURAL);
+	errors += choice_test("descending", generate_descending, 5000, VERSIONSORT_NATURAL);
+	errors += choice_test("concatenated", generate_concatenated, 5000, VERSIONSORT_NATURAL);
+	errors += choice_test("nearly sorted", generate_nearly_sorted, 5000, VERSIONSORT_NATURAL);
+
+	return errors;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define LIBVERSION_NO_DEPRECATED /* disable deprecated APIs */
+
+#include <libversion/version.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_COMPONENTS 64
+#define MAX_KEY_LENGTH 256
+
+typedef struct {
+	const char* version;
+	size_t count;
+	int mismatch;
+	version_component_t components[MAX_COMPONENTS];
+} collector_t;
+
+static void collect_component(const version_component_t* component, const char* text, void* userdata) {
+	collector_t* collector = (collector_t*)userdata;
+
+	if (collector->count < MAX_COMPONENTS)
+		collector->components[collector->count] = *component;
+	collector->count++;
+
+	/* text passed to callback must match the original string */
+	if (memcmp(text, collector->version + component->offset, component->length) != 0)
+		collector->mismatch = 1;
+}
+
+/* feeds version split into chunks of given size, and checks results against non-streaming APIs */
+static int stream_chunked_test(const char* v, int flags, size_t chunk_size) {
+	unsigned char expected_key[MAX_KEY_LENGTH], key[MAX_KEY_LENGTH];
+	version_component_t expected_components[MAX_COMPONENTS];
+	size_t expected_key_length = version_key(v, flags, expected_key, sizeof(expected_key));
+	size_t expected_count = version_tokenize(v, flags, expected_components, MAX_COMPONENTS);
+	size_t length = strlen(v), pos, key_length;
+	version_stream_t stream;
+	collector_t collector;
+
+	collector.version = v;
+	collector.count = 0;
+	collector.mismatch = 0;
+
+	version_stream_init(&stream, flags, key, sizeof(key));
+	version_stream_set_callback(&stream, collect_component, &collector);
+	for (pos = 0; pos < length; pos += chunk_size)
+		version_stream_feed(&stream, v + pos, length - pos < chunk_size ? length - pos : chunk_size);
+	key_length = version_stream_finish(&stream);
+
+	if (key_length != expected_key_length || memcmp(key, expected_key, key_length) != 0) {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x) in chunks of %d: key mismatch\n", v, flags, (int)chunk_size);
+		return 1;
+	}
+	if (collector.count != expected_count || collector.mismatch || memcmp(collector.components, expected_components, expected_count * sizeof(version_component_t)) != 0) {
+		fprintf(stderr, "[FAIL] \"%s\" (0x%x) in chunks of %d: components mismatch\n", v, flags, (int)chunk_size);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int stream_test(const char* v, int flags) {
+	size_t length = strlen(v), chunk_size;
+	int errors = 0;
+
+	for (chunk_size = 1; chunk_size <= length + 1; chunk_size++)
+		errors += stream_chunked_test(v, flags, chunk_size);
+
+	if (errors == 0)
+		fprintf(stderr, "[ OK ] \"%s\" (0x%x): streamed results match in all chunk sizes\n", v, flags);
+
+	return errors != 0;
+}
+
+static int split_test(const char* first, const char* second, const char* expected) {
+	unsigned char key[MAX_KEY_LENGTH], expected_key[MAX_KEY_LENGTH];
+	size_t expected_length = version_key(expected, 0, expected_key, sizeof(expected_key));
+	size_t length;
+	version_stream_t stream;
+
+	version_stream_init(&stream, 0, key, sizeof(key));
+	version_stream_feed(&stream, first, strlen(first));
+	version_stream_feed(&stream, second, strlen(second));
+	length = version_stream_finish(&stream);
+
+	if (length != expected_length || memcmp(key, expected_key, length) != 0) {
+		fprintf(stderr, "[FAIL] \"%s\" + \"%s\" != \"%s\"\n", first, second, expected);
+		return 1;
+	}
+
+	fprintf(stderr, "[ OK ] \"%s\" + \"%s\" == \"%s\"\n", first, second, expected);
+	return 0;
+}
+
+int main() {
+	char long_version[160];
+	int errors = 0;
+
+	memset(long_version, '7', 100);
+	strcpy(long_version + 100, "alpha.longwordwhichdoesnotfitintoinlinebuffer.3");
+
+	fprintf(stderr, "Test group: streamed results match\n");
+	errors += stream_test("", 0);
+	errors += stream_test("1.2.3", 0);
+	errors += stream_test("...1..0002...", 0);
+	errors += stream_test("1.0alpha1", 0);
+	errors += stream_test("1.0a", 0);
+	errors += stream_test("1.0a1b", 0);
+	errors += stream_test("1.0patch1.pl2", 0);
+	errors += stream_test("1.0p1", VERSIONFLAG_P_IS_PATCH);
+	errors += stream_test("1.0foo1", VERSIONFLAG_ANY_IS_PATCH);
+	errors += stream_test("1.0.0", VERSIONFLAG_LOWER_BOUND);
+	errors += stream_test("1.0.0", VERSIONFLAG_UPPER_BOUND);
+	errors += stream_test(long_version, 0);
+
+	fprintf(stderr, "\nTest group: tokens spanning chunk boundary\n");
+	errors += split_test("1.1", "0", "1.10");
+	errors += split_test("1.0a", "lpha", "1.0alpha");
+	errors += split_test("1.0a", "1", "1.0a1");
+	errors += split_test("1.0p", "atch1", "1.0patch1");
+	errors += split_test("1.", "", "1");
+
+	return errors;
+}
@@ -0,0 +1,575 @@
+// Copyright (c) 2026 libversion contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Multi-threaded scaling benchmark
+//
+// Runs library operations from 1 to N threads, either on data shared
+// by all threads or on per-thread copies, and reports throughput and
+// scaling efficiency (throughput relative to linear scaling of single
+// threaded throughput). Efficiency which drops on shared data while
+// staying high on disjoint data indicates false sharing or contention.
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libversion/config.h>
+#include <libversion/corpus.h>
+#include <libversion/filter.h>
+#include <libversion/keydict.h>
+#include <libversion/outdated.h>
+#include <libversion/sort.h>
+#include <libversion/version.h>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Dataset = std::vector<std::string>;
+
+const size_t FIXED_KEY_WIDTH = 16;
+const size_t KEYDICT_TRAINING_SIZE = 100000;
+
+enum class Workload {
+	COMPARE4,
+	KEY,
+	KEY_MULTI,
+	STREAM,
+	SORT_ITEMS,
+	SORT_FIXED,
+	FILTER,
+	KEYDICT,
+	CORPUS_LOAD,
+	OUTDATED,
+};
+
+const char* WorkloadName(Workload workload) {
+	switch (workload) {
+	case Workload::COMPARE4: return "compare4";
+	case Workload::KEY: return "key";
+	case Workload::KEY_MULTI: return "key_multi";
+	case Workload::STREAM: return "stream";
+	case Workload::SORT_ITEMS: return "sort_items";
+	case Workload::SORT_FIXED: return "sort_fixed";
+	case Workload::FILTER: return "filter";
+	case Workload::KEYDICT: return "keydict";
+	case Workload::CORPUS_LOAD: return "corpus_load";
+	case Workload::OUTDATED: return "outdated";
+	}
+	return "?";
+}
+
+Dataset GenerateDataset(size_t size) {
+	static const char* suffixes[] = { "", "", "", "a", "alpha1", "rc2", "pl1", ".0", "-1", ".20240101" };
+	static const size_t num_suffixes = sizeof(suffixes) / sizeof(suffixes[0]);
+
+	Dataset dataset;
+	unsigned seed = 1;
+	char buffer[64];
+
+	dataset.reserve(size);
+	for (size_t i = 0; i < size; ++i) {
+		seed = seed * 1103515245 + 12345;
+		snprintf(buffer, sizeof(buffer), "%u.%u.%u%s", (seed >> 8) % 4, (seed >> 12) % 12, (seed >> 16) % 30, suffixes[(seed >> 24) % num_suffixes]);
+		dataset.emplace_back(buffer);
+	}
+
+	return dataset;
+}
+
+// binary keys of versions, used as a dataset for sorting
+Dataset BuildKeys(const Dataset& dataset) {
+	Dataset keys;
+	keys.reserve(dataset.size());
+	for (const auto& version: dataset) {
+		std::string key(version_key(version.c_str(), 0, nullptr, 0), '\0');
+		version_key(version.c_str(), 0, reinterpret_cast<unsigned char*>(&key[0]), key.size());
+		keys.emplace_back(std::move(key));
+	}
+	return keys;
+}
+
+// fixed width keys of versions, used as a dataset for fixed key sorting
+Dataset BuildFixedKeys(const Dataset& dataset) {
+	Dataset keys;
+	keys.reserve(dataset.size());
+	for (const auto& version: dataset) {
+		std::string key(FIXED_KEY_WIDTH, '\0');
+		version_key_fixed(version.c_str(), 0, reinterpret_cast<unsigned char*>(&key[0]), key.size());
+		keys.emplace_back(std::move(key));
+	}
+	return keys;
+}
+
+// serialized dictionary trained on the leading keys
+std::string BuildKeydictImage(const Dataset& keys) {
+	std::vector<const unsigned char*> pointers;
+	std::vector<size_t> lengths;
+	for (size_t i = 0; i < keys.size() && i < KEYDICT_TRAINING_SIZE; ++i) {
+		pointers.push_back(reinterpret_cast<const unsigned char*>(keys[i].data()));
+		lengths.push_back(keys[i].size());
+	}
+	version_keydict_t* dict = version_keydict_train(pointers.data(), lengths.data(), pointers.size());
+	if (dict == nullptr) {
+		std::cerr << "cannot train key dictionary" << std::endl;
+		exit(1);
+	}
+	std::string image(version_keydict_serialize(dict, nullptr, 0), '\0');
+	version_keydict_serialize(dict, reinterpret_cast<unsigned char*>(&image[0]), image.size());
+	version_keydict_free(dict);
+	return image;
+}
+
+// serialized library objects used by workloads
+struct Images {
+	std::string filter;
+	std::string keydict;
+};
+
+// library objects opened from own copy of images, so disjoint instances share no memory
+class Objects {
+private:
+	Images images_;
+	version_filter_t* filter_ = nullptr;
+	version_keydict_t* keydict_ = nullptr;
+
+public:
+	explicit Objects(const Images& images) : images_(images) {
+		if (!images_.filter.empty()) {
+			filter_ = version_filter_view(images_.filter.data(), images_.filter.size());
+		}
+		if (!images_.keydict.empty()) {
+			keydict_ = version_keydict_deserialize(reinterpret_cast<const unsigned char*>(images_.keydict.data()), images_.keydict.size());
+		}
+	}
+
+	Objects(const Objects&) = delete;
+	Objects& operator=(const Objects&) = delete;
+
+	~Objects() {
+		version_filter_free(filter_);
+		version_keydict_free(keydict_);
+	}
+
+	const version_filter_t* Filter() const {
+		return filter_;
+	}
+
+	const version_keydict_t* Keydict() const {
+		return keydict_;
+	}
+};
+
+// image of a filter holding every other version of the dataset, so about half of lookups are hits
+std::string BuildFilterImage(const Dataset& dataset) {
+	version_filter_t* filter = version_filter_create(dataset.size() / 2 + 1, 10);
+	if (filter == nullptr) {
+		std::cerr << "cannot create filter" << std::endl;
+		exit(1);
+	}
+	for (size_t i = 0; i < dataset.size(); i += 2) {
+		version_filter_add(filter, dataset[i].c_str(), 0);
+	}
+	std::string image(version_filter_serialize(filter, nullptr, 0), '\0');
+	version_filter_serialize(filter, reinterpret_cast<unsigned char*>(&image[0]), image.size());
+	version_filter_free(filter);
+	return image;
+}
+
+// processes items [begin, end) of the dataset, returns a value which depends on results so work is not optimized out
+unsigned RunSlice(Workload workload, const Dataset& dataset, const Objects& objects, size_t begin, size_t end) {
+	static const int multi_flags[] = { 0, VERSIONFLAG_P_IS_PATCH, VERSIONFLAG_ANY_IS_PATCH };
+	static const size_t num_multi_flags = sizeof(multi_flags) / sizeof(multi_flags[0]);
+
+	unsigned char key[256];
+	unsigned char multi_storage[num_multi_flags][256];
+	unsigned char* multi_keys[num_multi_flags] = { multi_storage[0], multi_storage[1], multi_storage[2] };
+	size_t multi_lengths[num_multi_flags];
+	unsigned result = 0;
+
+	if (workload == Workload::SORT_ITEMS) {
+		// the slice of keys is sorted as a single batch; item array is reused so only library allocations remain
+		static thread_local std::vector<version_sort_item_t> items;
+		items.clear();
+		for (size_t i = begin; i < end; ++i) {
+			items.push_back({reinterpret_cast<const unsigned char*>(dataset[i].data()), dataset[i].size(), nullptr, 0});
+		}
+		version_sort_items(items.data(), items.size(), VERSIONSORT_AUTO);
+		return items.empty() ? 0 : items.front().key_length;
+	}
+
+	if (workload == Workload::SORT_FIXED) {
+		// fixed keys are sorted in place, so the slice is copied into a reused buffer first
+		static thread_local std::vector<unsigned char> elements;
+		elements.clear();
+		for (size_t i = begin; i < end; ++i) {
+			elements.insert(elements.end(), dataset[i].begin(), dataset[i].end());
+		}
+		if (!version_sort_fixed(elements.data(), end - begin, FIXED_KEY_WIDTH, FIXED_KEY_WIDTH, nullptr, nullptr)) {
+			std::cerr << "cannot sort fixed keys" << std::endl;
+			exit(1);
+		}
+		return elements.empty() ? 0 : elements.front();
+	}
+
+	for (size_t i = begin; i < end; ++i) {
+		const std::string& version = dataset[i];
+
+		switch (workload) {
+		case Workload::COMPARE4:
+			result += version_compare4(version.c_str(), dataset[i + 1 == dataset.size() ? 0 : i + 1].c_str(), 0, 0);
+			break;
+		case Workload::KEY:
+			result += version_key(version.c_str(), 0, key, sizeof(key));
+			break;
+		case Workload::KEY_MULTI:
+			result += version_key_multi(version.c_str(), multi_flags, num_multi_flags, multi_keys, sizeof(multi_storage[0]), multi_lengths);
+			break;
+		case Workload::STREAM: {
+			// split each version in two chunks to exercise reassembly
+			version_stream_t stream;
+			size_t half = version.size() / 2;
+			version_stream_init(&stream, 0, key, sizeof(key));
+			version_stream_feed(&stream, version.data(), half);
+			version_stream_feed(&stream, version.data() + half, version.size() - half);
+			result += version_stream_finish(&stream);
+			break;
+		}
+		case Workload::FILTER:
+			result += version_filter_contains(objects.Filter(), version.c_str(), 0);
+			break;
+		case Workload::KEYDICT:
+			result += version_keydict_compress(objects.Keydict(), reinterpret_cast<const unsigned char*>(version.data()), version.size(), key, sizeof(key));
+			break;
+		case Workload::SORT_ITEMS:
+		case Workload::SORT_FIXED:
+		case Workload::CORPUS_LOAD:
+		case Workload::OUTDATED:
+			break;
+		}
+	}
+
+	return result;
+}
+
+struct Measurement {
+	double ops_per_second = 0;
+	unsigned checksum = 0;  // combined results of operations, reported so the work cannot be optimized out
+};
+
+// runs per-item workload in the given number of threads for the given duration
+Measurement MeasureItems(Workload workload, const Dataset& shared, const Images& images, bool disjoint, size_t num_threads, double duration) {
+	static const size_t slice_size = 1024;
+
+	Objects shared_objects(images);
+
+	std::atomic<size_t> ready(0);
+	std::atomic<bool> start(false), stop(false);
+	std::vector<size_t> ops(num_threads);
+	std::vector<unsigned> sinks(num_threads);
+	std::vector<std::thread> threads;
+
+	for (size_t t = 0; t < num_threads; ++t) {
+		threads.emplace_back([&, t]() {
+			// disjoint copy is made by the thread itself, so its memory is local to it
+			Dataset copy;
+			if (disjoint) {
+				copy = shared;
+			}
+			const Dataset& dataset = disjoint ? copy : shared;
+
+			Images no_images;
+			Objects own_objects(disjoint ? images : no_images);
+			const Objects& objects = disjoint ? own_objects : shared_objects;
+
+			// counters are kept local and only published when done, so the benchmark itself does not false share
+			size_t local_ops = 0;
+			unsigned sink = 0;
+			size_t pos = (dataset.size() / num_threads * t) / slice_size * slice_size;
+
+			ready++;
+			while (!start.load(std::memory_order_acquire)) {
+				std::this_thread::yield();
+			}
+
+			while (!stop.load(std::memory_order_relaxed)) {
+				size_t end = std::min(pos + slice_size, dataset.size());
+				sink += RunSlice(workload, dataset, objects, pos, end);
+				local_ops += end - pos;
+				pos = end == dataset.size() ? 0 : end;
+			}
+
+			ops[t] = local_ops;
+			sinks[t] = sink;
+		});
+	}
+
+	while (ready.load() != num_threads) {
+		std::this_thread::yield();
+	}
+
+	auto started = Clock::now();
+	start.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(std::chrono::duration<double>(duration));
+	stop.store(true);
+
+	for (auto& thread: threads) {
+		thread.join();
+	}
+	double elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+
+	Measurement result;
+	size_t total = 0;
+	for (size_t t = 0; t < num_threads; ++t) {
+		total += ops[t];
+		result.checksum += sinks[t];
+	}
+
+	result.ops_per_second = total / elapsed;
+	return result;
+}
+
+// corpus loading is parallelized by the library itself, so threads are passed to it
+Measurement MeasureCorpusLoad(const std::string& path, size_t num_threads, double duration) {
+	size_t records = 0;
+	auto started = Clock::now();
+	double elapsed = 0;
+
+	do {
+		version_corpus_t* corpus = version_corpus_load_file(path.c_str(), 0, num_threads);
+		if (corpus == nullptr) {
+			std::cerr << "cannot load " << path << std::endl;
+			exit(1);
+		}
+		records += version_corpus_size(corpus);
+		version_corpus_free(corpus);
+		elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+	} while (elapsed < duration);
+
+	Measurement result;
+	result.ops_per_second = records / elapsed;
+	return result;
+}
+
+// classification is parallelized by the library itself, by packages
+Measurement MeasureOutdated(std::vector<version_outdated_row_t>& rows, size_t num_threads, double duration) {
+	size_t processed = 0;
+	auto started = Clock::now();
+	double elapsed = 0;
+
+	do {
+		if (!version_outdated_classify(rows.data(), rows.size(), 0, 2, num_threads)) {
+			std::cerr << "cannot classify versions" << std::endl;
+			exit(1);
+		}
+		processed += rows.size();
+		elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+	} while (elapsed < duration);
+
+	Measurement result;
+	result.ops_per_second = processed / elapsed;
+	return result;
+}
+
+std::vector<size_t> GetThreadCounts(size_t max_threads) {
+	std::vector<size_t> counts;
+	for (size_t count = 1; count < max_threads; count *= 2) {
+		counts.push_back(count);
+	}
+	counts.push_back(max_threads);
+	return counts;
+}
+
+void PrintHeader() {
+	printf("%-12s %-9s %7s %14s %14s %10s\n", "workload", "data", "threads", "total Mops/s", "thread Mops/s", "efficiency");
+}
+
+void PrintRow(Workload workload, const char* data, size_t num_threads, const Measurement& measurement, const Measurement& baseline) {
+	double efficiency = baseline.ops_per_second > 0 ? measurement.ops_per_second / (baseline.ops_per_second * num_threads) : 0;
+	printf(
+		"%-12s %-9s %7lu %14.2f %14.2f %9.0f%%\n",
+		WorkloadName(workload),
+		data,
+		(unsigned long)num_threads,
+		measurement.ops_per_second / 1e6,
+		measurement.ops_per_second / num_threads / 1e6,
+		efficiency * 100
+	);
+	fflush(stdout);
+}
+
+Dataset ReadDataset(const char* path) {
+	Dataset dataset;
+	std::ifstream stream(path);
+	std::string line;
+	while (std::getline(stream, line)) {
+		dataset.push_back(line);
+	}
+	return dataset;
+}
+
+std::string WriteTemporaryCorpus(const Dataset& dataset) {
+	char path[] = "/tmp/version_bench.XXXXXX";
+	int fd = mkstemp(path);
+	if (fd == -1) {
+		std::cerr << "cannot create temporary file" << std::endl;
+		exit(1);
+	}
+	close(fd);
+
+	std::ofstream stream(path);
+	for (const auto& version: dataset) {
+		stream << version << '\n';
+	}
+	return path;
+}
+
+void print_version() {
+	std::cerr << "libversion " << LIBVERSION_VERSION << std::endl;
+}
+
+void print_usage(const char* progname) {
+	std::cerr << "Usage: " << progname << " [-t threads] [-d seconds] [-n count] [path]\n";
+	std::cerr << "\n";
+	std::cerr << " -t N     - maximal number of threads (default: number of CPUs)\n";
+	std::cerr << " -d S     - duration of each measurement in seconds (default 0.5)\n";
+	std::cerr << " -n N     - number of generated versions, if no path is given (default 1000000)\n";
+	std::cerr << "\n";
+	std::cerr << " -h, -?   - print usage and exit\n";
+	std::cerr << " -V       - print version and exit" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+	int ch;
+	const char* progname = argv[0];
+	size_t max_threads = std::thread::hardware_concurrency();
+	size_t count = 1000000;
+	double duration = 0.5;
+
+	while ((ch = getopt(argc, argv, "t:d:n:hV")) != -1) {
+		switch (ch) {
+		case 't':
+			max_threads = atoi(optarg);
+			break;
+		case 'd':
+			duration = atof(optarg);
+			break;
+		case 'n':
+			count = atol(optarg);
+			break;
+		case 'h':
+		case '?':
+			print_usage(progname);
+			return 0;
+		case 'V':
+			print_version();
+			return 0;
+		default:
+			print_usage(progname);
+			return 1;
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	if (max_threads == 0) {
+		max_threads = 1;
+	}
+
+	Dataset dataset = argc > 0 ? ReadDataset(argv[0]) : GenerateDataset(count);
+	if (dataset.empty()) {
+		std::cerr << "no versions to benchmark" << std::endl;
+		return 1;
+	}
+
+	std::vector<size_t> thread_counts = GetThreadCounts(max_threads);
+
+	Dataset keys = BuildKeys(dataset);
+	Dataset fixed_keys = BuildFixedKeys(dataset);
+	Images images;
+	images.filter = BuildFilterImage(dataset);
+	images.keydict = BuildKeydictImage(keys);
+	unsigned checksum = 0;
+
+	PrintHeader();
+	for (Workload workload: {Workload::COMPARE4, Workload::KEY, Workload::KEY_MULTI, Workload::STREAM, Workload::SORT_ITEMS, Workload::SORT_FIXED, Workload::FILTER, Workload::KEYDICT}) {
+		const Dataset& items = workload == Workload::SORT_ITEMS || workload == Workload::KEYDICT ? keys : workload == Workload::SORT_FIXED ? fixed_keys : dataset;
+		for (bool disjoint: {false, true}) {
+			Measurement baseline;
+			for (size_t num_threads: thread_counts) {
+				Measurement measurement = MeasureItems(workload, items, images, disjoint, num_threads, duration);
+				checksum += measurement.checksum;
+				if (num_threads == 1) {
+					baseline = measurement;
+				}
+				PrintRow(workload, disjoint ? "disjoint" : "shared", num_threads, measurement, baseline);
+			}
+		}
+	}
+
+	std::string path = argc > 0 ? argv[0] : WriteTemporaryCorpus(dataset);
+	Measurement baseline;
+	for (size_t num_threads: thread_counts) {
+		Measurement measurement = MeasureCorpusLoad(path, num_threads, duration);
+		if (num_threads == 1) {
+			baseline = measurement;
+		}
+		PrintRow(Workload::CORPUS_LOAD, "file", num_threads, measurement, baseline);
+	}
+	if (argc == 0) {
+		unlink(path.c_str());
+	}
+
+	// versions are spread over packages, so classification has work to split between threads
+	static const size_t num_packages = 1000;
+	std::vector<std::string> packages;
+	std::vector<version_outdated_row_t> rows(dataset.size());
+	for (size_t i = 0; i < num_packages; ++i) {
+		packages.push_back("package" + std::to_string(i));
+	}
+	for (size_t i = 0; i < dataset.size(); ++i) {
+		const std::string& package = packages[i % num_packages];
+		rows[i] = {package.data(), package.size(), dataset[i].data(), dataset[i].size(), 0};
+	}
+
+	baseline = Measurement();
+	for (size_t num_threads: thread_counts) {
+		Measurement measurement = MeasureOutdated(rows, num_threads, duration);
+		if (num_threads == 1) {
+			baseline = measurement;
+		}
+		PrintRow(Workload::OUTDATED, "rows", num_threads, measurement, baseline);
+	}
+
+	fprintf(stderr, "result checksum: %08x\n", checksum);
+
+	return 0;
+}
@@ -26,18 +26,15 @@
 
 #include <libversion/config.h>
 #include <libversion/version.h>
-#include <libversion/private/parse.h>
 
 void version_explain(const char* v, int flags) {
-    component_t components[2];
+    version_iter_t iter;
+    version_component_t component;
 
     fprintf(stderr, "%3s %s\n", "M/O", "Data");
-    while (*v != '\0') {
-        size_t len = get_next_version_component(&v, components, flags);
-
-        for (size_t i = 0; i < len; i++) {
-            fprintf(stderr, "%3d \"%.*s\"\n", components[i].metaorder, (int)(components[i].end - components[i].start), components[i].start);
-        }
+    version_iter_init(&iter, v, flags);
+    while (version_iter_next(&iter, &component)) {
+        fprintf(stderr, "%3d \"%.*s\"\n", component.metaorder, (int)component.length, v + component.offset);
     }
 }
 
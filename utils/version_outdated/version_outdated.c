@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <libversion/config.h>
+#include <libversion/outdated.h>
+
+typedef struct {
+	char* data;
+	size_t length;
+	size_t capacity;
+} buffer_t;
+
+static void print_version() {
+	fprintf(stderr, "libversion %s\n", LIBVERSION_VERSION);
+}
+
+static void print_usage(const char* progname) {
+	fprintf(stderr, "Usage: %s [-pa] [-b depth] [-t threads] [path ...]\n", progname);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "Reads tab separated package, repository and version rows, and prints\n");
+	fprintf(stderr, "them with status column added, which is one of newest, outdated or\n");
+	fprintf(stderr, "legacy (outdated, but newest in its release branch). Newest versions\n");
+	fprintf(stderr, "are found among all repositories, and the repository column is only\n");
+	fprintf(stderr, "passed through.\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " -p       - 'p' letter is treated as 'patch' instead of 'pre'\n");
+	fprintf(stderr, " -a       - any alphabetic characters are treated as post-release\n");
+	fprintf(stderr, " -b N     - release branch is defined by first N version components\n");
+	fprintf(stderr, "            (default 2, 0 disables legacy status)\n");
+	fprintf(stderr, " -t N     - number of threads (default 0, which is the number of CPUs)\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " -h, -?   - print usage and exit\n");
+	fprintf(stderr, " -v       - print version and exit\n");
+}
+
+static int read_stream(FILE* file, buffer_t* buffer) {
+	size_t nread;
+	char* data;
+
+	do {
+		if (buffer->length == buffer->capacity) {
+			buffer->capacity = buffer->capacity ? buffer->capacity * 2 : 65536;
+			if ((data = realloc(buffer->data, buffer->capacity)) == NULL)
+				return 0;
+			buffer->data = data;
+		}
+		nread = fread(buffer->data + buffer->length, 1, buffer->capacity - buffer->length, file);
+		buffer->length += nread;
+	} while (nread > 0);
+
+	if (ferror(file))
+		return 0;
+
+	/* last line of each input is terminated, even if input is not */
+	if (buffer->length > 0 && buffer->data[buffer->length - 1] != '\n') {
+		if (buffer->length == buffer->capacity) {
+			if ((data = realloc(buffer->data, buffer->capacity + 1)) == NULL)
+				return 0;
+			buffer->data = data;
+			buffer->capacity++;
+		}
+		buffer->data[buffer->length++] = '\n';
+	}
+
+	return 1;
+}
+
+static const char* status_name(int status) {
+	switch (status) {
+	case VERSIONSTATUS_NEWEST: return "newest";
+	case VERSIONSTATUS_LEGACY: return "legacy";
+	default: return "outdated";
+	}
+}
+
+int main(int argc, char** argv) {
+	int ch, flags = 0, branch_depth = 2, threads = 0, arg, status = 0;
+	const char* progname = argv[0];
+	buffer_t input = { NULL, 0, 0 };
+	version_outdated_row_t* rows = NULL;
+	const char** lines = NULL;
+	size_t num_rows = 0, i, line_number = 0;
+	char* cur;
+	char* end;
+	char* next;
+	char* tab1;
+	char* tab2;
+	FILE* file;
+
+	while ((ch = getopt(argc, argv, "pab:t:hv")) != -1) {
+		switch (ch) {
+		case 'p':
+			flags |= VERSIONFLAG_P_IS_PATCH;
+			break;
+		case 'a':
+			flags |= VERSIONFLAG_ANY_IS_PATCH;
+			break;
+		case 'b':
+			branch_depth = atoi(optarg);
+			break;
+		case 't':
+			threads = atoi(optarg);
+			break;
+		case 'h':
+		case '?':
+			print_usage(progname);
+			return 0;
+		case 'v':
+			print_version();
+			return 0;
+		default:
+			print_usage(progname);
+			return 1;
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	if (argc == 0 && !read_stream(stdin, &input)) {
+		fprintf(stderr, "%s: cannot read standard input\n", progname);
+		return 1;
+	}
+	for (arg = 0; arg < argc; arg++) {
+		if ((file = fopen(argv[arg], "rb")) == NULL || !read_stream(file, &input)) {
+			fprintf(stderr, "%s: cannot read %s\n", progname, argv[arg]);
+			return 1;
+		}
+		fclose(file);
+	}
+
+	for (i = 0; i < input.length; i++)
+		num_rows += input.data[i] == '\n';
+
+	rows = malloc((num_rows ? num_rows : 1) * sizeof(version_outdated_row_t));
+	lines = malloc((num_rows ? num_rows : 1) * sizeof(const char*));
+	if (rows == NULL || lines == NULL) {
+		fprintf(stderr, "%s: out of memory\n", progname);
+		return 1;
+	}
+
+	/* rows point into the input, which is split into lines in place */
+	num_rows = 0;
+	end = input.data + input.length;
+	for (cur = input.data; cur < end; cur = next + 1) {
+		next = memchr(cur, '\n', end - cur);
+		*next = '\0';
+		line_number++;
+
+		if (cur == next)
+			continue;
+
+		if ((tab1 = strchr(cur, '\t')) == NULL || (tab2 = strchr(tab1 + 1, '\t')) == NULL) {
+			fprintf(stderr, "%s: line %lu: expected package, repository and version separated by tabs\n", progname, (unsigned long)line_number);
+			return 1;
+		}
+
+		/* repository column is not used for classification, it's just printed back as a part of the line */
+		lines[num_rows] = cur;
+		rows[num_rows].package = cur;
+		rows[num_rows].package_length = tab1 - cur;
+		rows[num_rows].version = tab2 + 1;
+		rows[num_rows].version_length = next - (tab2 + 1);
+		if (rows[num_rows].version_length > 0 && next[-1] == '\r')
+			rows[num_rows].version_length--;
+		num_rows++;
+	}
+
+	if (!version_outdated_classify(rows, num_rows, flags, branch_depth, threads)) {
+		fprintf(stderr, "%s: out of memory\n", progname);
+		status = 1;
+	} else {
+		for (i = 0; i < num_rows; i++)
+			printf("%.*s\t%s\n", (int)(rows[i].version + rows[i].version_length - lines[i]), lines[i], status_name(rows[i].status));
+	}
+
+	free(rows);
+	free(lines);
+	free(input.data);
+
+	return status;
+}
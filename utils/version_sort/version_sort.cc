@@ -19,23 +19,139 @@
 // THE SOFTWARE.
 
 #include <getopt.h>
+#include <sys/resource.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include <libversion/config.h>
+#include <libversion/sort.h>
 #include <libversion/version.h>
 
+class Profiler {
+public:
+	enum Phase {
+		READ,
+		SPLIT,
+		KEY,
+		SORT,
+		DEDUP,
+		WRITE,
+		NUM_PHASES,
+	};
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct PhaseStats {
+		double wall = 0;
+		double cpu = 0;
+	};
+
+	bool enabled_;
+	PhaseStats phases_[NUM_PHASES];
+	Phase current_ = READ;
+	Clock::time_point wall_start_;
+	std::clock_t cpu_start_ = 0;
+
+	static const char* PhaseName(int phase) {
+		static const char* names[NUM_PHASES] = { "read", "split", "key", "sort", "dedup", "write" };
+		return names[phase];
+	}
+
+	static long PeakMemoryKiB() {
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return -1;
+		}
+#ifdef __APPLE__
+		return usage.ru_maxrss / 1024;  // bytes on macOS
+#else
+		return usage.ru_maxrss;
+#endif
+	}
+
+public:
+	size_t bytes = 0;
+	size_t lines = 0;
+	size_t key_bytes = 0;
+	size_t output_lines = 0;
+	const char* engine = "";
+
+	Profiler(bool enabled) : enabled_(enabled) {
+	}
+
+	void Start(Phase phase) {
+		if (enabled_) {
+			current_ = phase;
+			wall_start_ = Clock::now();
+			cpu_start_ = std::clock();
+		}
+	}
+
+	void Stop() {
+		if (enabled_) {
+			phases_[current_].wall += std::chrono::duration<double>(Clock::now() - wall_start_).count();
+			phases_[current_].cpu += double(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+		}
+	}
+
+	void Report(std::ostream& stream) const {
+		if (!enabled_) {
+			return;
+		}
+
+		char buffer[128];
+		PhaseStats total;
+
+		snprintf(buffer, sizeof(buffer), "%-8s %12s %12s\n", "phase", "wall, ms", "cpu, ms");
+		stream << buffer;
+		for (int phase = 0; phase < NUM_PHASES; ++phase) {
+			snprintf(buffer, sizeof(buffer), "%-8s %12.3f %12.3f\n", PhaseName(phase), phases_[phase].wall * 1000, phases_[phase].cpu * 1000);
+			stream << buffer;
+			total.wall += phases_[phase].wall;
+			total.cpu += phases_[phase].cpu;
+		}
+		snprintf(buffer, sizeof(buffer), "%-8s %12.3f %12.3f\n", "total", total.wall * 1000, total.cpu * 1000);
+		stream << buffer;
+
+		stream << "bytes:        " << bytes << '\n';
+		stream << "lines:        " << lines << '\n';
+		stream << "output lines: " << output_lines << '\n';
+		stream << "key bytes:    " << key_bytes << '\n';
+		stream << "sort engine:  " << engine << '\n';
+		stream << "peak memory:  " << PeakMemoryKiB() << " KiB" << std::endl;
+	}
+};
+
 class VersionsList {
 private:
 	int flags_;
-	std::vector<std::string> versions_;
+	std::string data_;
+	std::vector<version_sort_item_t> lines_;
+	std::vector<unsigned char> keys_;
+
+	// empty version verbose output starts comparing with
+	version_sort_item_t empty_;
+	unsigned char empty_key_[VERSION_KEY_MAX_LENGTH(0)];
 
-	bool VersionLess(const std::string& a, const std::string& b) const {
-		int res = version_compare4(a.c_str(), b.c_str(), flags_, flags_);
+	static int CompareKeys(const version_sort_item_t& a, const version_sort_item_t& b) {
+		int res = std::memcmp(a.key, b.key, std::min(a.key_length, b.key_length));
+		if (res != 0) {
+			return res;
+		}
+		return a.key_length < b.key_length ? -1 : a.key_length > b.key_length ? 1 : 0;
+	}
+
+	static bool VersionLess(const version_sort_item_t& a, const version_sort_item_t& b) {
+		int res = CompareKeys(a, b);
 		if (res < 0) {
 			return true;
 		}
@@ -43,66 +159,166 @@ private:
 			return false;
 		}
 
-		return a < b;  // fallback to stringwise comparison for stable ordering
+		// fallback to stringwise comparison for stable ordering
+		return std::string(a.text, a.text_length) < std::string(b.text, b.text_length);
 	}
 
 public:
 	VersionsList(int flags) : flags_(flags) {
+		empty_.text = "";
+		empty_.text_length = 0;
+		empty_.key = empty_key_;
+		empty_.key_length = version_key("", flags_, empty_key_, sizeof(empty_key_));
 	}
 
 	void Read(std::istream& stream) {
-		std::string line;
-		while (std::getline(stream, line)) {
-			versions_.push_back(line);
+		char buffer[65536];
+		while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0) {
+			data_.append(buffer, stream.gcount());
+		}
+
+		// last line of each input is terminated, even if input is not
+		if (!data_.empty() && data_.back() != '\n') {
+			data_.push_back('\n');
 		}
 	}
 
-	void Sort() {
-		std::sort(
-			versions_.begin(),
-			versions_.end(),
-			[this](const std::string& a, const std::string& b) -> bool {
-				return VersionLess(a, b);
-			}
+	void Split() {
+		size_t offset = 0, next;
+		while ((next = data_.find('\n', offset)) != std::string::npos) {
+			data_[next] = '\0';  // makes each line usable as a C string in place
+			lines_.push_back(version_sort_item_t{nullptr, 0, data_.c_str() + offset, next - offset});
+			offset = next + 1;
+		}
+	}
+
+	void BuildKeys() {
+		// keys storage may move while growing, so keys are only pointed to when it's complete
+		std::vector<size_t> key_offsets;
+		key_offsets.reserve(lines_.size());
+
+		for (auto& line: lines_) {
+			size_t capacity = VERSION_KEY_MAX_LENGTH(line.text_length);
+			size_t offset = keys_.size();
+			keys_.resize(offset + capacity);
+			line.key_length = version_key(line.text, flags_, &keys_[offset], capacity);
+			keys_.resize(offset + line.key_length);
+			key_offsets.push_back(offset);
+		}
+
+		for (size_t i = 0; i < lines_.size(); ++i) {
+			lines_[i].key = keys_.data() + key_offsets[i];
+		}
+	}
+
+	int Sort(int engine) {
+		if (engine == VERSIONSORT_AUTO) {
+			engine = version_sort_choose_engine(lines_.data(), lines_.size());
+		}
+		version_sort_items(lines_.data(), lines_.size(), engine);
+		return engine;
+	}
+
+	void Dedup() {
+		// keeps first of each group of equal versions, which is bytewise least one after sorting
+		lines_.erase(
+			std::unique(
+				lines_.begin(),
+				lines_.end(),
+				[](const version_sort_item_t& a, const version_sort_item_t& b) -> bool {
+					return CompareKeys(a, b) == 0;
+				}
+			),
+			lines_.end()
 		);
 	}
 
 	void Dump(std::ostream& stream) const {
-		for (const auto& version: versions_) {
-			stream << version << '\n';
+		for (const auto& line: lines_) {
+			stream.write(line.text, line.text_length) << '\n';
 		}
 	}
 
 	void VerboseDump(std::ostream& stream) const {
-		std::string prev;
-		for (const auto& version: versions_) {
-			stream << version << (VersionLess(prev, version) ? " (<)" : " (==)") << '\n';
-			prev = version;
+		const version_sort_item_t* prev = &empty_;
+		for (const auto& line: lines_) {
+			stream.write(line.text, line.text_length) << (VersionLess(*prev, line) ? " (<)" : " (==)") << '\n';
+			prev = &line;
 		}
 	}
+
+	size_t GetDataSize() const {
+		return data_.size();
+	}
+
+	size_t GetLinesCount() const {
+		return lines_.size();
+	}
+
+	size_t GetKeysSize() const {
+		return keys_.size();
+	}
 };
 
+static const struct {
+	const char* name;
+	int engine;
+} engines[] = {
+	{ "auto", VERSIONSORT_AUTO },
+	{ "comparison", VERSIONSORT_COMPARISON },
+	{ "radix", VERSIONSORT_RADIX },
+	{ "packed", VERSIONSORT_PACKED },
+	{ "natural", VERSIONSORT_NATURAL },
+};
+
+static const char* engine_name(int engine) {
+	for (const auto& item: engines) {
+		if (item.engine == engine) {
+			return item.name;
+		}
+	}
+	return "unknown";
+}
+
 static void print_version() {
 	std::cerr << "libversion " << LIBVERSION_VERSION << std::endl;
 }
 
 static void print_usage(const char* progname) {
-	std::cerr << "Usage: " << progname << " [-pa] [path]\n";
+	std::cerr << "Usage: " << progname << " [-pauv] [--profile] [--engine=NAME] [path ...]\n";
 	std::cerr << "\n";
-	std::cerr << " -p       - 'p' letter is treated as 'patch' instead of 'pre'\n";
-	std::cerr << " -a       - any alphabetic characters are treated as post-release\n";
-	std::cerr << " -v       - verbose mode (display whether version is different from the previous one)\n";
+	std::cerr << " -p        - 'p' letter is treated as 'patch' instead of 'pre'\n";
+	std::cerr << " -a        - any alphabetic characters are treated as post-release\n";
+	std::cerr << " -u        - output only the first of equal versions\n";
+	std::cerr << " -v        - verbose mode (display whether version is different from the previous one)\n";
+	std::cerr << " --profile - print time spent in each processing phase and memory usage to stderr\n";
+	std::cerr << " --engine=NAME\n";
+	std::cerr << "           - force sort engine (auto, comparison, radix, packed, natural)\n";
 	std::cerr << "\n";
-	std::cerr << " -h, -?   - print usage and exit\n";
-	std::cerr << " -V       - print version and exit" << std::endl;
+	std::cerr << " -h, -?    - print usage and exit\n";
+	std::cerr << " -V        - print version and exit" << std::endl;
 }
 
 int main(int argc, char** argv) {
+	enum {
+		OPTION_PROFILE = 256,
+		OPTION_ENGINE,
+	};
+
+	static const struct option longopts[] = {
+		{ "profile", no_argument, nullptr, OPTION_PROFILE },
+		{ "engine", required_argument, nullptr, OPTION_ENGINE },
+		{ nullptr, 0, nullptr, 0 },
+	};
+
 	int ch, flags = 0;
 	const char* progname = argv[0];
 	bool verbose = false;
+	bool unique = false;
+	bool profile = false;
+	int engine = -1;
 
-	while ((ch = getopt(argc, argv, "pahvV")) != -1) {
+	while ((ch = getopt_long(argc, argv, "pauhvV", longopts, nullptr)) != -1) {
 		switch (ch) {
 		case 'p':
 			flags |= VERSIONFLAG_P_IS_PATCH;
@@ -110,6 +326,9 @@ int main(int argc, char** argv) {
 		case 'a':
 			flags |= VERSIONFLAG_ANY_IS_PATCH;
 			break;
+		case 'u':
+			unique = true;
+			break;
 		case 'h':
 		case '?':
 			print_usage(progname);
@@ -120,6 +339,21 @@ int main(int argc, char** argv) {
 		case 'v':
 			verbose = true;
 			break;
+		case OPTION_PROFILE:
+			profile = true;
+			break;
+		case OPTION_ENGINE:
+			engine = -1;
+			for (const auto& item: engines) {
+				if (std::strcmp(item.name, optarg) == 0) {
+					engine = item.engine;
+				}
+			}
+			if (engine == -1) {
+				std::cerr << "Unknown sort engine: " << optarg << std::endl;
+				return 1;
+			}
+			break;
 		default:
 			print_usage(progname);
 			return 1;
@@ -130,7 +364,9 @@ int main(int argc, char** argv) {
 	argv += optind;
 
 	VersionsList versions(flags);
+	Profiler profiler(profile);
 
+	profiler.Start(Profiler::READ);
 	if (argc == 0) {
 		versions.Read(std::cin);
 	}
@@ -138,14 +374,40 @@ int main(int argc, char** argv) {
 		std::fstream fs(argv[arg]);
 		versions.Read(fs);
 	}
+	profiler.Stop();
+	profiler.bytes = versions.GetDataSize();
+
+	profiler.Start(Profiler::SPLIT);
+	versions.Split();
+	profiler.Stop();
+	profiler.lines = versions.GetLinesCount();
 
-	versions.Sort();
+	profiler.Start(Profiler::KEY);
+	versions.BuildKeys();
+	profiler.Stop();
+	profiler.key_bytes = versions.GetKeysSize();
 
+	profiler.Start(Profiler::SORT);
+	profiler.engine = engine_name(versions.Sort(engine == -1 ? VERSIONSORT_AUTO : engine));
+	profiler.Stop();
+
+	profiler.Start(Profiler::DEDUP);
+	if (unique) {
+		versions.Dedup();
+	}
+	profiler.Stop();
+	profiler.output_lines = versions.GetLinesCount();
+
+	profiler.Start(Profiler::WRITE);
 	if (verbose) {
 		versions.VerboseDump(std::cout);
 	} else {
 		versions.Dump(std::cout);
 	}
+	std::cout.flush();
+	profiler.Stop();
+
+	profiler.Report(std::cerr);
 
 	return 0;
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIBVERSION_UTILS_TRACE_H
+#define LIBVERSION_UTILS_TRACE_H
+
+#include <stddef.h>
+
+/*
+ * Trace file format
+ *
+ * File starts with TRACE_MAGIC, followed by call records:
+ *
+ * - kind (1 byte, TRACE_CALL_*)
+ * - result (1 byte, signed)
+ * - v1 flags, v2 flags (varints)
+ * - v1 length (varint), v1 bytes
+ * - v2 length (varint), v2 bytes
+ *
+ * Varints are unsigned LEB128.
+ */
+#define TRACE_MAGIC "LVTRACE1"
+#define TRACE_MAGIC_LENGTH 8
+
+#define TRACE_FILE_ENV "LIBVERSION_TRACE_FILE"
+
+enum {
+	TRACE_CALL_COMPARE2 = 2,
+	TRACE_CALL_COMPARE4 = 4,
+};
+
+#define TRACE_MAX_VARINT_LENGTH 10
+
+static inline size_t trace_put_varint(unsigned char* buffer, unsigned long long value) {
+	size_t length = 0;
+
+	while (value >= 0x80) {
+		buffer[length++] = (unsigned char)(value | 0x80);
+		value >>= 7;
+	}
+	buffer[length++] = (unsigned char)value;
+
+	return length;
+}
+
+/* returns number of bytes consumed, or 0 if the input is truncated */
+static inline size_t trace_get_varint(const unsigned char* buffer, size_t length, unsigned long long* value) {
+	size_t pos = 0;
+	int shift = 0;
+
+	*value = 0;
+	while (pos < length && shift < 64) {
+		*value |= (unsigned long long)(buffer[pos] & 0x7f) << shift;
+		if ((buffer[pos++] & 0x80) == 0)
+			return pos;
+		shift += 7;
+	}
+
+	return 0;
+}
+
+#endif /* LIBVERSION_UTILS_TRACE_H */
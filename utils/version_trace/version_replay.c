@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <libversion/config.h>
+#include <libversion/version.h>
+
+#include "trace.h"
+
+typedef struct {
+	int kind;
+	int result;
+	int v1_flags;
+	int v2_flags;
+	const char* v1;
+	const char* v2;
+} call_t;
+
+typedef struct {
+	call_t* calls;
+	size_t num_calls;
+	size_t bytes; /* total length of compared strings */
+	char* strings;
+} trace_t;
+
+static unsigned char* read_file(const char* path, size_t* length) {
+	FILE* file = fopen(path, "rb");
+	unsigned char* data = NULL;
+	unsigned char* newdata;
+	size_t capacity = 0, nread;
+
+	*length = 0;
+	if (file == NULL)
+		return NULL;
+
+	do {
+		if (*length == capacity) {
+			capacity = capacity ? capacity * 2 : 65536;
+			newdata = realloc(data, capacity);
+			if (newdata == NULL) {
+				free(data);
+				fclose(file);
+				return NULL;
+			}
+			data = newdata;
+		}
+		nread = fread(data + *length, 1, capacity - *length, file);
+		*length += nread;
+	} while (nread > 0);
+
+	fclose(file);
+	return data;
+}
+
+static int get_string(const unsigned char* data, size_t length, size_t* pos, char** out) {
+	unsigned long long string_length;
+	size_t consumed = trace_get_varint(data + *pos, length - *pos, &string_length);
+
+	if (consumed == 0 || string_length > length - *pos - consumed)
+		return 0;
+	*pos += consumed;
+
+	memcpy(*out, data + *pos, string_length);
+	(*out)[string_length] = '\0';
+	*out += string_length + 1;
+	*pos += string_length;
+	return 1;
+}
+
+static int parse_trace(const unsigned char* data, size_t length, trace_t* trace) {
+	size_t pos = TRACE_MAGIC_LENGTH, capacity = 0, consumed;
+	unsigned long long flags;
+	char* strings;
+	call_t* call;
+	call_t* calls;
+
+	if (length < TRACE_MAGIC_LENGTH || memcmp(data, TRACE_MAGIC, TRACE_MAGIC_LENGTH) != 0)
+		return 0;
+
+	/* strings take less space than the trace itself, NUL terminators included */
+	trace->strings = strings = malloc(length);
+	if (strings == NULL)
+		return 0;
+
+	while (pos < length) {
+		if (trace->num_calls == capacity) {
+			capacity = capacity ? capacity * 2 : 1024;
+			calls = realloc(trace->calls, capacity * sizeof(call_t));
+			if (calls == NULL)
+				return 0;
+			trace->calls = calls;
+		}
+
+		call = &trace->calls[trace->num_calls];
+		if (length - pos < 2)
+			return 0;
+		call->kind = data[pos++];
+		call->result = (signed char)data[pos++];
+
+		if ((consumed = trace_get_varint(data + pos, length - pos, &flags)) == 0)
+			return 0;
+		call->v1_flags = (int)flags;
+		pos += consumed;
+
+		if ((consumed = trace_get_varint(data + pos, length - pos, &flags)) == 0)
+			return 0;
+		call->v2_flags = (int)flags;
+		pos += consumed;
+
+		call->v1 = strings;
+		if (!get_string(data, length, &pos, &strings))
+			return 0;
+		call->v2 = strings;
+		if (!get_string(data, length, &pos, &strings))
+			return 0;
+
+		trace->bytes += strlen(call->v1) + strlen(call->v2);
+		trace->num_calls++;
+	}
+
+	return 1;
+}
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int replay(const trace_t* trace, size_t* mismatches) {
+	size_t i;
+	int result, checksum = 0;
+
+	for (i = 0; i < trace->num_calls; i++) {
+		const call_t* call = &trace->calls[i];
+
+		if (call->kind == TRACE_CALL_COMPARE2)
+			result = version_compare2(call->v1, call->v2);
+		else
+			result = version_compare4(call->v1, call->v2, call->v1_flags, call->v2_flags);
+
+		if (mismatches != NULL && result != call->result)
+			(*mismatches)++;
+
+		checksum += result;
+	}
+
+	return checksum;
+}
+
+static void print_version() {
+	fprintf(stderr, "libversion %s\n", LIBVERSION_VERSION);
+}
+
+static void print_usage(const char* progname) {
+	fprintf(stderr, "Usage: %s [-n iterations] trace\n", progname);
+	fprintf(stderr, "\n");
+	fprintf(stderr, " -n N     - replay the trace N times (default 10)\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " -h, -?   - print usage and exit\n");
+	fprintf(stderr, " -v       - print version and exit\n");
+}
+
+int main(int argc, char** argv) {
+	int ch, iterations = 10, iteration, checksum = 0;
+	const char* progname = argv[0];
+	unsigned char* data;
+	size_t length, mismatches = 0;
+	trace_t trace;
+	double start, elapsed;
+
+	while ((ch = getopt(argc, argv, "n:hv")) != -1) {
+		switch (ch) {
+		case 'n':
+			iterations = atoi(optarg);
+			break;
+		case 'h':
+		case '?':
+			print_usage(progname);
+			return 0;
+		case 'v':
+			print_version();
+			return 0;
+		default:
+			print_usage(progname);
+			return 1;
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	if (argc != 1 || iterations < 1) {
+		print_usage(progname);
+		return 1;
+	}
+
+	memset(&trace, 0, sizeof(trace));
+	data = read_file(argv[0], &length);
+	if (data == NULL) {
+		fprintf(stderr, "%s: cannot read %s\n", progname, argv[0]);
+		return 1;
+	}
+	if (!parse_trace(data, length, &trace)) {
+		fprintf(stderr, "%s: %s is not a valid trace\n", progname, argv[0]);
+		return 1;
+	}
+	free(data);
+
+	/* warm up, and check that results are the same as recorded */
+	replay(&trace, &mismatches);
+
+	start = now();
+	for (iteration = 0; iteration < iterations; iteration++)
+		checksum += replay(&trace, NULL);
+	elapsed = now() - start;
+
+	printf("libversion:  %s\n", LIBVERSION_VERSION);
+	printf("calls:       %lu x %d\n", (unsigned long)trace.num_calls, iterations);
+	printf("mismatches:  %lu\n", (unsigned long)mismatches);
+	printf("checksum:    %d\n", checksum);
+	printf("time:        %.3f s\n", elapsed);
+	if (elapsed > 0) {
+		printf("throughput:  %.0f calls/s, %.1f MB/s\n", trace.num_calls * iterations / elapsed, trace.bytes * iterations / elapsed / 1e6);
+		if (trace.num_calls > 0)
+			printf("latency:     %.1f ns/call\n", elapsed * 1e9 / ((double)trace.num_calls * iterations));
+	}
+
+	free(trace.calls);
+	free(trace.strings);
+
+	return mismatches != 0;
+}
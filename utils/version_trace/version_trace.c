@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 libversion contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * LD_PRELOAD shim which records version_compare2/version_compare4 calls
+ * of unmodified binaries into a trace file, for replaying with
+ * version_replay.
+ *
+ * LD_PRELOAD=./libversion_trace.so LIBVERSION_TRACE_FILE=out.trace some_binary
+ */
+
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <libversion/version.h>
+
+#include "trace.h"
+
+typedef int (*compare2_t)(const char* v1, const char* v2);
+typedef int (*compare4_t)(const char* v1, const char* v2, int v1_flags, int v2_flags);
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+static compare2_t real_compare2;
+static compare4_t real_compare4;
+static FILE* trace_file;
+
+/* version_compare2 may call version_compare4 through PLT, which should not be recorded twice */
+static __thread int nesting;
+
+static void init(void) {
+	char default_path[64];
+	const char* path = getenv(TRACE_FILE_ENV);
+	const char* error;
+
+	/* assigning through void** avoids object to function pointer conversion */
+	*(void**)(&real_compare2) = dlsym(RTLD_NEXT, "version_compare2");
+	*(void**)(&real_compare4) = dlsym(RTLD_NEXT, "version_compare4");
+
+	/* e.g. libversion is linked statically or loaded with dlopen(), so there's nothing to forward calls to */
+	if (real_compare2 == NULL || real_compare4 == NULL) {
+		error = dlerror();
+		fprintf(stderr, "version_trace: cannot find libversion functions to forward calls to: %s\n", error != NULL ? error : "symbol not found");
+		abort();
+	}
+
+	if (path == NULL || *path == '\0') {
+		snprintf(default_path, sizeof(default_path), "libversion.%ld.trace", (long)getpid());
+		path = default_path;
+	}
+
+	trace_file = fopen(path, "wb");
+	if (trace_file == NULL) {
+		fprintf(stderr, "version_trace: cannot open %s, calls will not be recorded\n", path);
+		return;
+	}
+
+	fwrite(TRACE_MAGIC, 1, TRACE_MAGIC_LENGTH, trace_file);
+}
+
+__attribute__((destructor)) static void finish(void) {
+	if (trace_file != NULL) {
+		fclose(trace_file);
+		trace_file = NULL;
+	}
+}
+
+static void record_call(int kind, int result, const char* v1, const char* v2, int v1_flags, int v2_flags) {
+	unsigned char header[2 + TRACE_MAX_VARINT_LENGTH * 3], length2[TRACE_MAX_VARINT_LENGTH];
+	size_t header_length = 0, length2_length;
+	size_t v1_length = strlen(v1), v2_length = strlen(v2);
+
+	if (trace_file == NULL)
+		return;
+
+	header[header_length++] = (unsigned char)kind;
+	header[header_length++] = (unsigned char)(signed char)result;
+	header_length += trace_put_varint(header + header_length, (unsigned)v1_flags);
+	header_length += trace_put_varint(header + header_length, (unsigned)v2_flags);
+	header_length += trace_put_varint(header + header_length, v1_length);
+	length2_length = trace_put_varint(length2, v2_length);
+
+	/* keep records of concurrent callers from interleaving */
+	flockfile(trace_file);
+	fwrite(header, 1, header_length, trace_file);
+	fwrite(v1, 1, v1_length, trace_file);
+	fwrite(length2, 1, length2_length, trace_file);
+	fwrite(v2, 1, v2_length, trace_file);
+	funlockfile(trace_file);
+}
+
+int version_compare2(const char* v1, const char* v2) {
+	int result;
+
+	pthread_once(&init_once, init);
+
+	nesting++;
+	result = real_compare2(v1, v2);
+	nesting--;
+
+	if (nesting == 0)
+		record_call(TRACE_CALL_COMPARE2, result, v1, v2, 0, 0);
+
+	return result;
+}
+
+int version_compare4(const char* v1, const char* v2, int v1_flags, int v2_flags) {
+	int result;
+
+	pthread_once(&init_once, init);
+
+	nesting++;
+	result = real_compare4(v1, v2, v1_flags, v2_flags);
+	nesting--;
+
+	if (nesting == 0)
+		record_call(TRACE_CALL_COMPARE4, result, v1, v2, v1_flags, v2_flags);
+
+	return result;
+}
@@ -0,0 +1,279 @@
+// Copyright (c) 2026 libversion contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Sort-free deduplication and counting of equal versions
+//
+// Lines are hashed in parallel with version_hash(), which is equal
+// for equal versions, and routed into hash table shards by the top
+// bits of the hash. Each shard is then filled by a single thread, so
+// no locking is needed, and since every thread routes lines of its
+// input range in order, and shards take per-thread lists in range
+// order, first occurrence of each version is known without sorting.
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libversion/config.h>
+#include <libversion/version.h>
+
+namespace {
+
+constexpr int SHARD_BITS = 6;
+constexpr size_t NUM_SHARDS = size_t(1) << SHARD_BITS;
+
+class VersionsGrouper {
+private:
+	struct Slot {
+		uint64_t hash;
+		size_t first;  // index of first line of the group, plus one; zero for empty slot
+		size_t count;
+	};
+
+	struct LineGroup {
+		size_t first;
+		size_t count;
+	};
+
+	int flags_;
+	std::string data_;
+	std::vector<size_t> offsets_;
+	std::vector<uint64_t> hashes_;
+	std::vector<size_t> counts_;  // for first line of each group, number of lines in the group; zero otherwise
+
+	const char* Line(size_t index) const {
+		return data_.c_str() + offsets_[index];
+	}
+
+	template<class F>
+	static void RunParallel(size_t num_threads, F func) {
+		std::vector<std::thread> threads;
+		for (size_t thread = 1; thread < num_threads; ++thread) {
+			threads.emplace_back(func, thread);
+		}
+		func(0);
+		for (auto& thread: threads) {
+			thread.join();
+		}
+	}
+
+	// groups are counted in shard's own table, and only collected when it's complete
+	std::vector<LineGroup> FillShard(const std::vector<std::vector<size_t>>& routed) const {
+		size_t num_lines = 0;
+		for (const auto& lines: routed) {
+			num_lines += lines.size();
+		}
+
+		size_t capacity = 16;
+		while (capacity < num_lines * 2) {
+			capacity *= 2;
+		}
+		std::vector<Slot> table(capacity, Slot{0, 0, 0});
+
+		for (const auto& lines: routed) {
+			for (size_t line: lines) {
+				uint64_t hash = hashes_[line];
+				size_t pos = size_t(hash) & (capacity - 1);
+
+				// equal hashes almost certainly mean equal versions, but verify to be exact
+				while (table[pos].first != 0 && (table[pos].hash != hash || version_compare4(Line(table[pos].first - 1), Line(line), flags_, flags_) != 0)) {
+					pos = (pos + 1) & (capacity - 1);
+				}
+
+				if (table[pos].first == 0) {
+					table[pos] = Slot{hash, line + 1, 0};
+				}
+				++table[pos].count;
+			}
+		}
+
+		std::vector<LineGroup> groups;
+		for (const auto& slot: table) {
+			if (slot.first != 0) {
+				groups.push_back(LineGroup{slot.first - 1, slot.count});
+			}
+		}
+		return groups;
+	}
+
+public:
+	VersionsGrouper(int flags) : flags_(flags) {
+	}
+
+	void Read(std::istream& stream) {
+		char buffer[65536];
+		while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0) {
+			data_.append(buffer, stream.gcount());
+		}
+
+		// last line of each input is terminated, even if input is not
+		if (!data_.empty() && data_.back() != '\n') {
+			data_.push_back('\n');
+		}
+	}
+
+	void Group(size_t num_threads) {
+		size_t offset = 0, next;
+		while ((next = data_.find('\n', offset)) != std::string::npos) {
+			data_[next] = '\0';  // makes each line usable as a C string in place
+			offsets_.push_back(offset);
+			offset = next + 1;
+		}
+
+		const size_t num_lines = offsets_.size();
+		num_threads = std::max<size_t>(1, std::min(num_threads, num_lines / 1024));
+
+		hashes_.resize(num_lines);
+		counts_.assign(num_lines, 0);
+
+		// hash lines and route them to shards; routed[thread][shard] lists line indexes in order
+		std::vector<std::vector<std::vector<size_t>>> routed(num_threads, std::vector<std::vector<size_t>>(NUM_SHARDS));
+		RunParallel(num_threads, [&](size_t thread) {
+			size_t begin = num_lines / num_threads * thread;
+			size_t end = thread + 1 == num_threads ? num_lines : num_lines / num_threads * (thread + 1);
+			for (size_t line = begin; line < end; ++line) {
+				hashes_[line] = version_hash(Line(line), flags_);
+				routed[thread][hashes_[line] >> (64 - SHARD_BITS)].push_back(line);
+			}
+		});
+
+		// fill shards; each one is only touched by a single thread
+		std::vector<std::vector<LineGroup>> shard_groups(NUM_SHARDS);
+		RunParallel(num_threads, [&](size_t thread) {
+			std::vector<std::vector<size_t>> shard_routed(num_threads);
+			for (size_t shard = thread; shard < NUM_SHARDS; shard += num_threads) {
+				for (size_t source = 0; source < num_threads; ++source) {
+					shard_routed[source].swap(routed[source][shard]);
+				}
+				shard_groups[shard] = FillShard(shard_routed);
+				for (auto& lines: shard_routed) {
+					std::vector<size_t>().swap(lines);
+				}
+			}
+		});
+
+		// shared counts are only written after shards are done, so threads never write to the same cache lines
+		for (const auto& groups: shard_groups) {
+			for (const auto& group: groups) {
+				counts_[group.first] = group.count;
+			}
+		}
+	}
+
+	void Dump(std::ostream& stream, bool count) const {
+		char buffer[32];
+		for (size_t line = 0; line < offsets_.size(); ++line) {
+			if (counts_[line] == 0) {
+				continue;
+			}
+			if (count) {
+				snprintf(buffer, sizeof(buffer), "%7lu ", static_cast<unsigned long>(counts_[line]));
+				stream << buffer;
+			}
+			stream << Line(line) << '\n';
+		}
+	}
+};
+
+void print_version() {
+	std::cerr << "libversion " << LIBVERSION_VERSION << std::endl;
+}
+
+void print_usage(const char* progname) {
+	std::cerr << "Usage: " << progname << " [-pac] [-t threads] [path ...]\n";
+	std::cerr << "\n";
+	std::cerr << "Prints the first of each group of equal versions, in the order of input.\n";
+	std::cerr << "\n";
+	std::cerr << " -p        - 'p' letter is treated as 'patch' instead of 'pre'\n";
+	std::cerr << " -a        - any alphabetic characters are treated as post-release\n";
+	std::cerr << " -c        - prefix lines with the number of equal versions\n";
+	std::cerr << " -t N      - number of threads (default is the number of CPUs)\n";
+	std::cerr << "\n";
+	std::cerr << " -h, -?    - print usage and exit\n";
+	std::cerr << " -V        - print version and exit" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+	int ch, flags = 0;
+	const char* progname = argv[0];
+	bool count = false;
+	size_t threads = std::max(1u, std::thread::hardware_concurrency());
+
+	while ((ch = getopt(argc, argv, "pact:hV")) != -1) {
+		switch (ch) {
+		case 'p':
+			flags |= VERSIONFLAG_P_IS_PATCH;
+			break;
+		case 'a':
+			flags |= VERSIONFLAG_ANY_IS_PATCH;
+			break;
+		case 'c':
+			count = true;
+			break;
+		case 't':
+			threads = std::max(1, atoi(optarg));
+			break;
+		case 'h':
+		case '?':
+			print_usage(progname);
+			return 0;
+		case 'V':
+			print_version();
+			return 0;
+		default:
+			print_usage(progname);
+			return 1;
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	VersionsGrouper versions(flags);
+
+	if (argc == 0) {
+		versions.Read(std::cin);
+	}
+	for (int arg = 0; arg < argc; ++arg) {
+		std::ifstream fs(argv[arg]);
+		if (!fs) {
+			std::cerr << progname << ": cannot read " << argv[arg] << std::endl;
+			return 1;
+		}
+		versions.Read(fs);
+	}
+
+	versions.Group(threads);
+	versions.Dump(std::cout, count);
+	std::cout.flush();
+
+	return 0;
+}